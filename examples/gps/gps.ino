@@ -37,8 +37,13 @@ void setupWatch()
 
     watch->openBL();
 
-    tft->setAddrWindow(30, 25, 168, 77);
-    tft->pushColors((uint16_t *)acsiplogo, 0x3288);
+    //Decode the compressed logo one scanline at a time
+    uint16_t line[ACSIPLOGO_WIDTH];
+    AcsipRleDecoder logo(acsiplogo);
+    tft->setAddrWindow(30, 25, ACSIPLOGO_WIDTH, ACSIPLOGO_HEIGHT);
+    while (logo.read(line, ACSIPLOGO_WIDTH)) {
+        tft->pushColors(line, ACSIPLOGO_WIDTH);
+    }
 
     watch->enableLDO4();
     watch->enableLDO3();
@@ -141,6 +146,9 @@ void gpsBegin()
     ret = s76g.getTtff(sec);
     ACSIP_CHECK_ERROR(ret);
     Serial.printf("TTFF is %f\n", sec);
+
+    //Poll the fix from process() instead of blocking on "gps get_data"
+    s76g.setGPSPollInterval(1000, S7XG_GPS_DATA_RAW);
 }
 
 
@@ -153,14 +161,16 @@ void setup()
 
 void loop()
 {
-    if (millis() - utimerStart > 1000) {
+    s76g.process();
 
-        //GPS data type, which can be S7XG_GPS_DATA_DMS , S7XG_GPS_DATA_RAW , S7XG_GPS_DATA_DD
-        GPSDataType type = S7XG_GPS_DATA_RAW;
+    if (millis() - utimerStart > 1000) {
 
-        ret = s76g.getData(data, type);
+        //Latest fix of the background poll, in the type given to setGPSPollInterval
+        data = s76g.GPSData;
+        GPSDataType type = data.type;
+        uint32_t age = s76g.getFixAge();
 
-        if (data.isValid) {
+        if (data.isValid && age < 5000) {
             tft->fillScreen(TFT_BLACK);
             tft->setCursor(0, 0);
             switch (type) {
@@ -198,8 +208,8 @@ void loop()
                 tft->println();
 
 
-                Serial.printf("ret:%d  %hu/%hhu/%hhu %hhu:%hhu:%hhu dd:%d mm:%d ss:%lf dd:%d mm:%d ss:%lf [%f]\n",
-                              ret,
+                Serial.printf("age:%u  %hu/%hhu/%hhu %hhu:%hhu:%hhu dd:%d mm:%d ss:%lf dd:%d mm:%d ss:%lf [%f]\n",
+                              (unsigned)age,
                               data.dms.datetime.year,
                               data.dms.datetime.month,
                               data.dms.datetime.day,
@@ -235,8 +245,8 @@ void loop()
                 tft->print(data.raw.lng);
 
 
-                Serial.printf("ret:%d %u/%hhu/%hhu %hhu:%hhu:%hhu lat:%f lng:%f [%f]\n",
-                              ret,
+                Serial.printf("age:%u %u/%hhu/%hhu %hhu:%hhu:%hhu lat:%f lng:%f [%f]\n",
+                              (unsigned)age,
                               data.raw.datetime.year,
                               data.raw.datetime.month,
                               data.raw.datetime.day,
@@ -271,8 +281,8 @@ void loop()
                 tft->print("lng:");
                 tft->print(data.dd.lng);
 
-                Serial.printf("ret:%d %hu/%hhu/%hhu %hhu:%hhu:%hhu lat:%f lng:%f [%f]\n",
-                              ret,
+                Serial.printf("age:%u %hu/%hhu/%hhu %hhu:%hhu:%hhu lat:%f lng:%f [%f]\n",
+                              (unsigned)age,
                               data.dd.datetime.year,
                               data.dd.datetime.month,
                               data.dd.datetime.day,
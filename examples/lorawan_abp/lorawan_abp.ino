@@ -1,14 +1,14 @@
-#pragma mark - Depend CayenneLPP and ArduinoJson libraries
+#pragma mark - Depend ArduinoJson library
 /*
 cd ~/Arduino/libraries
-git clone https://github.com/ElectronicCats/CayenneLPP.git
 git clone https://github.com/bblanchon/ArduinoJson.git
 */
 
 #include "config.h"
 #include <acsip.h>
+#include <acsip_channel.h>
+#include <acsip_lpp.h>
 #include "acsiplogo.h"
-#include <CayenneLPP.h>
 #include <ArduinoJson.h>
 
 
@@ -16,7 +16,12 @@ TTGOClass *watch = nullptr;
 TFT_eSPI *tft;
 HardwareSerial *hwSerial = nullptr;
 Acsip s76g;
-CayenneLPP lpp(160);
+//Sized for EU868 DR0, the slowest data rate the uplink has to pass at.
+//Other bands are checked against their own limit before each uplink
+AcsipLppFor<868, 0> lpp;
+int band = 0;
+static_assert(acsipLppSize(ACSIP_LPP_TEMPERATURE, ACSIP_LPP_BAROMETER, ACSIP_LPP_ANALOG_OUTPUT)
+              <= decltype(lpp)::capacity(), "uplink does not fit DR0");
 
 struct GPSDataStruct data;
 uint32_t utimerStart = 0;
@@ -57,8 +62,13 @@ void setupWatch()
 
     watch->openBL();
 
-    tft->setAddrWindow(30, 25, 168, 77);
-    tft->pushColors((uint16_t *)acsiplogo, 0x3288);
+    //Decode the compressed logo one scanline at a time
+    uint16_t line[ACSIPLOGO_WIDTH];
+    AcsipRleDecoder logo(acsiplogo);
+    tft->setAddrWindow(30, 25, ACSIPLOGO_WIDTH, ACSIPLOGO_HEIGHT);
+    while (logo.read(line, ACSIPLOGO_WIDTH)) {
+        tft->pushColors(line, ACSIPLOGO_WIDTH);
+    }
 
     watch->enableLDO4();
     watch->enableLDO3();
@@ -145,16 +155,16 @@ void lorawanBegin()
     ret = s76g.setAppSessionKey(appskey);
     ACSIP_CHECK_ERROR(ret);
 
-    //Set the corresponding channel frequency
-    s76g.setChannelFreq(0, 868100000);
-    s76g.setChannelFreq(1, 868300000);
-    s76g.setChannelFreq(2, 868500000);
-    s76g.setChannelFreq(3, 867100000);
-    s76g.setChannelFreq(4, 867300000);
-    s76g.setChannelFreq(5, 867500000);
-    s76g.setChannelFreq(6, 867700000);
-    s76g.setChannelFreq(7, 867900000);
-    s76g.setChannelFreq(8, 868800000);
+    //Set the TTN channel plan of the module region in one batch
+    ret = s76g.getBand(band);
+    ACSIP_CHECK_ERROR(ret);
+    const AcsipChannelPlan *plan = acsipChannelPlanForBand(band);
+    if (plan) {
+        ret = acsipChannelPlanApply(s76g, *plan);
+        ACSIP_CHECK_ERROR(ret);
+        ret = acsipChannelPlanVerify(s76g, *plan);
+        ACSIP_CHECK_ERROR(ret);
+    }
 
     //Connection method using ABP
     s76g.joinABP();
@@ -193,11 +203,17 @@ void loop()
         lpp.addBarometricPressure(2,  rand() % 3000);
         lpp.addAnalogOutput(3, rand() % 100 + 10);
 
-        int uplinkPort = 1;
-        ret = s76g.send(uplinkPort, lpp.getBuffer(), lpp.getSize());
-        Serial.printf("Send [%u] Byte\n", lpp.getSize());
-        if (ret != S7XG_OK) {
-            hwSerial->flush();
+        //US915 DR0 only carries 11 bytes, wait for a faster data rate
+        int dr = 0;
+        if (s76g.getDataRate(dr) == S7XG_OK && !lpp.fits(acsipMaxPayload(band, dr))) {
+            Serial.printf("Skip [%u] Byte, DR%d allows %u\n", lpp.size(), dr, acsipMaxPayload(band, dr));
+        } else {
+            int uplinkPort = 1;
+            ret = lpp.send(s76g, uplinkPort);
+            Serial.printf("Send [%u] Byte\n", lpp.size());
+            if (ret != S7XG_OK) {
+                hwSerial->flush();
+            }
         }
         utimerStart = millis();
     }
@@ -0,0 +1,17 @@
+// => Hardware select
+#define LILYGO_WATCH_2019_WITH_TOUCH        // To use T-Watch2019 with touchscreen, please uncomment this line
+// #define LILYGO_WATCH_2019_NO_TOUCH       // To use T-Watch2019 Not touchscreen , please uncomment this line
+// #define LILYGO_WATCH_BLOCK               // To use T-Watch Block , please uncomment this line
+
+//NOT SUPPORT ...
+// //#define LILYGO_WATCH_2020_V1
+//NOT SUPPORT ...
+
+// => Function select
+#define LILYGO_WATCH_HAS_S76_S78G
+
+#include <LilyGoWatch.h>
+
+
+
+
@@ -0,0 +1,121 @@
+/*
+ * Send a bit-packed uplink described by uplink_schema.h.
+ * The same header builds extras/codec_decode, which decodes the payload
+ * on a Linux host: 11 bytes, less than half of the Cayenne LPP frame.
+ */
+
+#include "config.h"
+#include <acsip.h>
+#include <acsip_channel.h>
+#include "uplink_schema.h"
+
+
+TTGOClass *watch = nullptr;
+HardwareSerial *hwSerial = nullptr;
+Acsip s76g;
+
+struct GPSDataStruct data;
+uint32_t utimerStart = 0;
+
+
+
+const char *appeui = "your ttn appeui";
+const char *deveui = "your ttn deveui";
+const char *appkey = "your ttn app key";
+
+int ret = 0;
+
+
+void setupWatch()
+{
+    Serial.begin(115200);
+
+    watch = TTGOClass::getWatch();
+    watch->begin();
+
+    watch->enableLDO4();
+    watch->enableLDO3();
+
+    hwSerial = new HardwareSerial(1);
+    hwSerial->begin(115200, SERIAL_8N1, GPS_RX, GPS_TX);
+    if (!s76g.begin(*hwSerial)) {
+        Serial.println("Initialization 'S76/78G' failed");
+        while (1);
+    }
+    Serial.printf("FW version: %s\n", s76g.getVersion());
+}
+
+void lorawanBegin()
+{
+    ret = s76g.GPSStart();
+    ACSIP_CHECK_ERROR(ret);
+
+    ret = s76g.setClass('A');
+    ACSIP_CHECK_ERROR(ret);
+
+    ret = s76g.setAppEui(appeui);
+    ACSIP_CHECK_ERROR(ret);
+
+    ret = s76g.setDevEui(deveui);
+    ACSIP_CHECK_ERROR(ret);
+
+    ret = s76g.setAppKey(appkey);
+    ACSIP_CHECK_ERROR(ret);
+
+    //Set the TTN channel plan of the module region in one batch
+    int band = 0;
+    ret = s76g.getBand(band);
+    ACSIP_CHECK_ERROR(ret);
+    const AcsipChannelPlan *plan = acsipChannelPlanForBand(band);
+    if (plan) {
+        ret = acsipChannelPlanApply(s76g, *plan);
+        ACSIP_CHECK_ERROR(ret);
+    }
+
+    //Connection method using OTAA
+    s76g.joinOTAA();
+
+    //Waiting to connect to TTN
+    while (!s76g.isJoin()) {
+        Serial.println("Wait for join to TTN");
+        delay(1500);
+    }
+    Serial.println("Join to TTN");
+}
+
+
+void setup()
+{
+    setupWatch();
+    lorawanBegin();
+}
+
+
+void loop()
+{
+    if (millis() - utimerStart > 20000) {
+        //Random sensor readings, the position of the last fix
+        double lat = 0, lng = 0;
+        if (s76g.getData(data, S7XG_GPS_DATA_DD) == S7XG_OK && data.isValid) {
+            lat = data.dd.lat;
+            lng = data.dd.lng;
+        }
+        //Out of range values are clamped to the field limits
+        uint8_t frame[AcsipUplink::size];
+        AcsipUplink::encode(frame,
+                            (rand() % 400) / 10.0,          // temperature, C
+                            950 + (rand() % 1000) / 10.0,   // pressure, hPa
+                            rand() % 100,                   // humidity, %
+                            rand() % 100,                   // battery, %
+                            lat,                            // latitude
+                            lng);                           // longitude
+
+        int uplinkPort = 1;
+        ret = s76g.send(uplinkPort, frame, AcsipUplink::size);
+        Serial.printf("Send [%u] Byte\n", (unsigned)AcsipUplink::size);
+        if (ret != S7XG_OK) {
+            hwSerial->flush();
+        }
+        utimerStart = millis();
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <acsip_codec.h>
+
+/*
+ * Uplink layout shared by this sketch and extras/codec_decode, which
+ * includes this file as well so the two sides cannot drift apart.
+ */
+typedef AcsipSchema<AcsipField<-400, 850, 10>,              // temperature, C
+                    AcsipField<3000, 11000, 10>,            // pressure, hPa
+                    AcsipField<0, 100>,                     // humidity, %
+                    AcsipField<0, 100>,                     // battery, %
+                    AcsipField<-900000, 900000, 10000>,     // latitude, degrees
+                    AcsipField<-1800000, 1800000, 10000> >  // longitude, degrees
+        AcsipUplink;
+
+static const char *const acsipUplinkNames[] = {
+    "temperature", "pressure", "humidity", "battery", "latitude", "longitude",
+};
+
+static_assert(sizeof(acsipUplinkNames) / sizeof(acsipUplinkNames[0]) == AcsipUplink::count, "one name per field");
@@ -36,8 +36,13 @@ void setupWatch()
 
     watch->openBL();
 
-    tft->setAddrWindow(30, 25, 168, 77);
-    tft->pushColors((uint16_t *)acsiplogo, 0x3288);
+    //Decode the compressed logo one scanline at a time
+    uint16_t line[ACSIPLOGO_WIDTH];
+    AcsipRleDecoder logo(acsiplogo);
+    tft->setAddrWindow(30, 25, ACSIPLOGO_WIDTH, ACSIPLOGO_HEIGHT);
+    while (logo.read(line, ACSIPLOGO_WIDTH)) {
+        tft->pushColors(line, ACSIPLOGO_WIDTH);
+    }
 
     watch->enableLDO4();
     watch->enableLDO3();
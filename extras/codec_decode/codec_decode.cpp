@@ -0,0 +1,102 @@
+/*
+ * Decode a bit-packed uplink on a Linux host. The layout is the one the
+ * lorawan_codec example sends, see examples/lorawan_codec/uplink_schema.h.
+ *
+ *  g++ -I../../src -I../../examples/lorawan_codec -o codec_decode codec_decode.cpp
+ *  ./codec_decode 4cfbdc...
+ *  ./codec_decode --check      round trips random values through the codec
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include "uplink_schema.h"
+
+// Largest step of a field, a decoded value is within half of it
+template <size_t I>
+static double step()
+{
+    return 1.0 / AcsipUplink::Field<I>::div;
+}
+
+template <size_t I>
+static double lower()
+{
+    return (double)AcsipUplink::Field<I>::min / AcsipUplink::Field<I>::div;
+}
+
+template <size_t I>
+static double upper()
+{
+    return (double)AcsipUplink::Field<I>::max / AcsipUplink::Field<I>::div;
+}
+
+static double pick(double lo, double hi)
+{
+    return lo + (hi - lo) * rand() / RAND_MAX;
+}
+
+static int check(unsigned rounds)
+{
+    double lo[] = {lower<0>(), lower<1>(), lower<2>(), lower<3>(), lower<4>(), lower<5>()};
+    double hi[] = {upper<0>(), upper<1>(), upper<2>(), upper<3>(), upper<4>(), upper<5>()};
+    double res[] = {step<0>(), step<1>(), step<2>(), step<3>(), step<4>(), step<5>()};
+    static_assert(sizeof(lo) / sizeof(lo[0]) == AcsipUplink::count, "check covers every field");
+
+    srand(1);
+    for (unsigned n = 0; n < rounds; n++) {
+        double in[AcsipUplink::count];
+        double out[AcsipUplink::count];
+        uint8_t frame[AcsipUplink::size];
+        for (size_t i = 0; i < AcsipUplink::count; i++) {
+            in[i] = pick(lo[i], hi[i]);
+        }
+        AcsipUplink::encode(frame, in[0], in[1], in[2], in[3], in[4], in[5]);
+        AcsipUplink::decode(frame, out);
+        for (size_t i = 0; i < AcsipUplink::count; i++) {
+            if (fabs(out[i] - in[i]) > res[i] / 2 + 1e-9) {
+                fprintf(stderr, "round %u: %s %.6f decoded as %.6f\n", n, acsipUplinkNames[i], in[i], out[i]);
+                return 1;
+            }
+        }
+    }
+    printf("%u round trips ok, %u bits in %u bytes\n", rounds, (unsigned)AcsipUplink::bits, (unsigned)AcsipUplink::size);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <hex payload> | --check\n", argv[0]);
+        return 1;
+    }
+    if (strcmp(argv[1], "--check") == 0) {
+        return check(100000);
+    }
+
+    uint8_t payload[256];
+    size_t len = 0;
+    const char *p = argv[1];
+    while (p[0] && p[1] && len < sizeof(payload)) {
+        unsigned v;
+        if (!isxdigit((unsigned char)p[0]) || !isxdigit((unsigned char)p[1]) || sscanf(p, "%2x", &v) != 1) {
+            fprintf(stderr, "invalid hex at offset %u\n", (unsigned)(p - argv[1]));
+            return 1;
+        }
+        payload[len++] = v;
+        p += 2;
+    }
+
+    if (len != AcsipUplink::size) {
+        fprintf(stderr, "expected %u bytes, got %u\n", (unsigned)AcsipUplink::size, (unsigned)len);
+        return 1;
+    }
+
+    double values[AcsipUplink::count];
+    AcsipUplink::decode(payload, values);
+    for (size_t i = 0; i < AcsipUplink::count; i++) {
+        printf("%-12s %g\n", acsipUplinkNames[i], values[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * Check and identify Acsip firmware images on a Linux host.
+ *
+ *  g++ -I../../src -o fw_identify fw_identify.cpp ../../src/acsip_firmware.cpp
+ *  ./fw_identify ../../firmware/LoRaWAN-S76G-EU868-V1-6-6-G11.hex
+ *
+ * Exit status is 0 when every file decodes cleanly and matches a known image.
+ */
+#include <stdio.h>
+#include "acsip_firmware.h"
+
+static const char *errors[] = {
+    "ok", "syntax error", "checksum error", "bad record", "truncated",
+};
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <image.hex> ...\n", argv[0]);
+        return 1;
+    }
+
+    int status = 0;
+    char chunk[4096];
+    AcsipHexDecoder decoder;
+
+    for (int i = 1; i < argc; i++) {
+        FILE *fp = fopen(argv[i], "rb");
+        if (!fp) {
+            perror(argv[i]);
+            status = 1;
+            continue;
+        }
+        decoder.reset();
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0 && decoder.feed(chunk, n)) {
+        }
+        fclose(fp);
+
+        AcsipHexError err = decoder.finish();
+        if (err != ACSIP_HEX_OK) {
+            printf("%s: %s at record %u\n", argv[i], errors[err], decoder.line());
+            status = 1;
+            continue;
+        }
+
+        const AcsipFirmwareImage *img = acsipFirmwareByCrc(decoder.crc(), decoder.size());
+        printf("%s: %s %s %s, %u bytes at 0x%08X, crc32 %08X, %s\n", argv[i],
+               decoder.model(), decoder.region(), decoder.version(),
+               decoder.size(), decoder.start(), decoder.crc(),
+               img ? img->file : "unknown image");
+        if (!img) {
+            status = 1;
+        }
+    }
+    return status;
+}
@@ -0,0 +1,49 @@
+/*
+ * Decode an Acsip track uplink on a Linux host.
+ *
+ *  g++ -I../../src -o track_decode track_decode.cpp ../../src/acsip_track.cpp
+ *  ./track_decode 0103...
+ */
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "acsip_track.h"
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <hex payload>\n", argv[0]);
+        return 1;
+    }
+
+    uint8_t payload[256];
+    size_t len = 0;
+    const char *p = argv[1];
+    while (p[0] && p[1] && len < sizeof(payload)) {
+        unsigned v;
+        if (!isxdigit((unsigned char)p[0]) || !isxdigit((unsigned char)p[1]) || sscanf(p, "%2x", &v) != 1) {
+            fprintf(stderr, "invalid hex at offset %u\n", (unsigned)(p - argv[1]));
+            return 1;
+        }
+        payload[len++] = v;
+        p += 2;
+    }
+
+    AcsipTrackDecoder decoder(payload, len);
+    if (!decoder.valid()) {
+        fprintf(stderr, "not a track payload\n");
+        return 1;
+    }
+
+    AcsipTrackPoint point;
+    uint8_t n = 0;
+    while (decoder.next(point)) {
+        printf("%u,%u,%.6f,%.6f\n", n++, point.time,
+               point.lat / 1e6, point.lng / 1e6);
+    }
+    if (n != decoder.count()) {
+        fprintf(stderr, "truncated, %u of %u points\n", n, decoder.count());
+        return 1;
+    }
+    return 0;
+}
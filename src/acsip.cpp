@@ -7,42 +7,13 @@
 
 static const char *rxTxMode[2] = {"cycle", "no_cycle"};
 
+//UART1 rates accepted by "sip set_baudrate", fastest first
+static const uint32_t baudRates[] = {115200, 57600, 19200, 9600};
+
 
 String Acsip::errrToString(int err_code)
 {
-    switch (err_code) {
-    case S7XG_OK:
-        return "OK";
-    case S7XG_FAILED:
-        return "Failed";
-    case S7XG_TIMEROUT:
-        return "Timeout";
-    case S7XG_JOINED:
-        return "Joined";
-    case S7XG_UNJOINED:
-        return "UnJoined";
-    case S7XG_INVALD:
-        return "Command invald";
-    case S7XG_ALREADY_JOINED:
-        return "Already Joined";
-    case S7XG_BUSY:
-        return "Busy";
-    case S7XG_INVALD_LEN:
-        return "Invald len";
-    case S7XG_GPS_NOT_INIT:
-        return "Not init";
-    case S7XG_GPS_NOT_POSITIONING:
-        return "Positioning";
-    case S7XG_GPS_SUCCESS:
-        return "Success";
-    case S7XG_GPS_ERROR:
-        return "GPS Connect Error";
-    case S7XG_COMMAND_ERROR:
-        return "Unknown command!";
-    default:
-        break;
-    }
-    return "Unkonw";
+    return errorToString(err_code);
 }
 
 
@@ -88,6 +59,30 @@ static int hexToString(const char *src, uint8_t *dst, size_t srcLen, size_t &dst
 }
 
 
+//radio_rx <data> <rssi> <snr>, decoded in place is allowed
+static int parseRadioRx(char *line, uint8_t *data, size_t size, size_t &len, int &rssi, int &snr)
+{
+    len = 0;
+    char *hexData = line + strlen("radio_rx") + 1;
+    char *str = strrchr(hexData, ' ');
+    if (str == NULL) {
+        return S7XG_FAILED;
+    }
+    snr = atoi(str + 1);
+    *str = '\0';
+    str = strrchr(hexData, ' ');
+    if (str == NULL) {
+        return S7XG_FAILED;
+    }
+    rssi = atoi(str + 1);
+    *str = '\0';
+    if (hexToString(hexData, data, size, len) != 0) {
+        return S7XG_INVALD_LEN;
+    }
+    return S7XG_OK;
+}
+
+
 template <typename T> int Acsip::getUnit(const char *cmd, T &value)
 {
     sendCmd(cmd);
@@ -104,6 +99,19 @@ template <typename T> int Acsip::getUnit(const char *cmd, T &value)
     return S7XG_OK;
 }
 
+int Acsip::getString(const char *cmd, char *dst, size_t size)
+{
+    sendCmd(cmd);
+    if (waitForAck(buffer) != S7XG_OK) {
+        return S7XG_TIMEROUT;
+    }
+    if (strlen(buffer) >= size) {
+        return S7XG_INVALD_LEN;
+    }
+    strcpy(dst, buffer);
+    return S7XG_OK;
+}
+
 int Acsip::getArgs(const char *cmd, const char *format, ...)
 {
     int err = 0;
@@ -141,6 +149,7 @@ int Acsip::snedConnamd(const char *format, ...)
     if (err < 0) {
         return S7XG_FAILED;
     }
+    waitIdle();
     _port->print(buffer);
     return S7XG_OK;
 }
@@ -154,6 +163,7 @@ int Acsip::universalSendConnamd(const char *format, ...)
     if (err < 0) {
         return S7XG_FAILED;
     }
+    waitIdle();
     _port->print(buffer);
     if (waitForAck(buffer) != S7XG_OK) {
         return S7XG_TIMEROUT;
@@ -172,17 +182,33 @@ int Acsip::universalSendCmd(const char *cmd)
     if (waitForAck(buffer) != S7XG_OK) {
         return S7XG_TIMEROUT;
     }
-    if (cmpstr("Ok")) {
+    return ackToError(buffer);
+}
+
+uint32_t Acsip::crc32(const void *data, size_t len, uint32_t crc)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        for (uint8_t k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+int Acsip::ackToError(const char *ack)
+{
+    if (strcmp(ack, "Ok") == 0) {
         return S7XG_OK;
-    } else if (cmpstr("Invalid")) {
+    } else if (strcmp(ack, "Invalid") == 0) {
         return S7XG_INVALD;
-    } else if (cmpstr("Please disconnect UART4 TX/RX")) {
+    } else if (strcmp(ack, "Please disconnect UART4 TX/RX") == 0) {
         return S7XG_GPS_ERROR;
-    } else if (cmpstr("Unknown command!")) {
+    } else if (strcmp(ack, "Unknown command!") == 0) {
         return S7XG_COMMAND_ERROR;
     }
-
-
     return S7XG_UNKONW;
 }
 
@@ -198,45 +224,65 @@ bool Acsip::cmpstr(const char *str)
 
 void Acsip::sendCmd(const char *cmd)
 {
+    waitIdle();
     _port->print(cmd);
     DEBUGLN(cmd);
 }
 
+//A queued command (the GPS poll for instance) may be on the wire. The module
+//delimits commands by UART idle time, so a blocking call waits for its reply
+void Acsip::waitIdle()
+{
+    while (_active) {
+        process();
+    }
+}
+
+void Acsip::notify(AcsipState state, uint32_t value)
+{
+    if (state >= ACSIP_STATE_GPS_OFF && state < ACSIP_STATE_MAX) {
+        _gpsState = state;
+    }
+    if (_state_callback) {
+        _state_callback(_state_arg, state, value);
+    }
+}
+
+/**
+ * @brief  waitForAck
+ * @note   Frames are assembled in the instance RX arena, 'ack' has to hold
+ *         ACSIP_BUFFER_SIZE bytes. Not to be mixed with queued commands.
+ */
 int Acsip::waitForAck(char *ack, uint32_t timeout)
 {
-    uint8_t serial_buffer[256] = {0};
-    int i = 0;
     uint32_t utimerStart;
     utimerStart = millis();
+    _rxLen = 0;
 
     while (1) {
         if (_port->available()) {
-            //Preventing buffer overflows
-            if (i >= sizeof(buffer))return S7XG_FAILED;
-            serial_buffer[i] = _port->read();
+            uint8_t c = _port->read();
 
 #ifdef DEBUG_SERIAL_HEX
 #ifdef DEBUG_PORT
             DEBUG("0x");
-            DEBUG_PORT.print(serial_buffer[i], HEX);
+            DEBUG_PORT.print(c, HEX);
             DEBUG(",");
 #endif
 #endif
             //respone command prefix [\n\r>>]
             //respone command suffix [\n]
-            if (serial_buffer[0] == 0xA && serial_buffer[1] == 0xD &&
-                    serial_buffer[2] == 0x3E && serial_buffer[3] == 0x3E
-                    && serial_buffer[i] == 0xA) {
-                memcpy(ack, &serial_buffer[5], i - 5);
-                ack[i - 5] = '\0';
+            if (feed(c)) {
+                strncpy(ack, &_rx[5], ACSIP_BUFFER_SIZE - 1);
+                ack[ACSIP_BUFFER_SIZE - 1] = '\0';
+                _rxLen = 0;
 #ifdef DEBUG_PORT
-                DEBUG_PORT.printf("Recvicer Done .. [size:%d] -> %s\n", i - 5, ack);
+                DEBUG_PORT.printf("Recvicer Done .. [size:%d] -> %s\n", strlen(ack), ack);
 #endif
                 return S7XG_OK;
             }
-            i++;
         }
-        if (millis() - utimerStart > timeout != 0 ? timeout :  _timeout) {
+        if (millis() - utimerStart > (timeout != 0 ? timeout :  _timeout)) {
             DEBUGLN(".");
 #ifdef DEBUG_PORT
             DEBUG_PORT.println("Time out flush uart!");
@@ -250,15 +296,116 @@ int Acsip::waitForAck(char *ack, uint32_t timeout)
             break;
         }
     }
+    _rxLen = 0;
+    return S7XG_TIMEROUT;
+}
+
+static bool matchToken(const char *frame, const char *prefix)
+{
+    size_t n = strlen(prefix);
+    if (strncmp(frame, prefix, n) != 0) {
+        return false;
+    }
+    return frame[n] == '\0' || frame[n] == ' ' || frame[n] == '(';
+}
+
+/**
+ * @brief  collect
+ * @note   Gather every frame of a multi-line reply into the command buffer.
+ *         One deadline covers the whole exchange, it is not restarted per
+ *         frame. Frames that do not fit drop the earlier ones, the last
+ *         frame is always kept.
+ * @param  spec: expected reply
+ * @param  rsp: the frames received
+ * @param  timeout: ms for the whole reply, 0 uses setTimeout value
+ * @retval err of the terminal token, spec.unexpected for any other final
+ *         frame, S7XG_TIMEROUT if the reply did not complete in time
+ */
+int Acsip::collect(const AcsipResponseSpec &spec, AcsipResponse &rsp, uint32_t timeout)
+{
+    uint32_t start = millis();
+    uint32_t limit = timeout != 0 ? timeout : _timeout;
+    uint8_t frames = 0;
+    size_t used = 0;
+
+    rsp.count = 0;
+    _rxLen = 0;
+
+    while (millis() - start <= limit) {
+        if (!_port->available() || !feed(_port->read())) {
+            continue;
+        }
+        const char *text = &_rx[5];
+        size_t len = strlen(text);
+        if (used + len + 1 > sizeof(buffer)) {
+            used = 0;
+            rsp.count = 0;
+            if (len > sizeof(buffer) - 1) len = sizeof(buffer) - 1;
+        }
+        memcpy(buffer + used, text, len);
+        buffer[used + len] = '\0';
+        if (rsp.count == ACSIP_RESPONSE_FRAMES) {
+            memmove(rsp.frame, rsp.frame + 1, sizeof(rsp.frame) - sizeof(rsp.frame[0]));
+            rsp.count--;
+        }
+        rsp.frame[rsp.count++] = buffer + used;
+        used += len + 1;
+        _rxLen = 0;
+        frames++;
+        DEBUG("Frame <- ");
+        DEBUGLN(rsp.last());
+
+        for (const AcsipToken *t = spec.terminal; t && t->prefix; t++) {
+            if (matchToken(rsp.last(), t->prefix)) {
+                return t->err;
+            }
+        }
+        bool more = false;
+        for (const char *const *p = spec.intermediate; p && *p; p++) {
+            if (matchToken(rsp.last(), *p)) {
+                more = true;
+                break;
+            }
+        }
+        if (!more || frames >= spec.frames) {
+            return spec.unexpected;
+        }
+    }
+    _rxLen = 0;
     return S7XG_TIMEROUT;
 }
 
 
-bool Acsip::begin(HardwareSerial &port)
+// Commands that differ between firmware releases
+static const struct {
+    const char *name;
+    int         version;
+    uint32_t    caps;
+} fwProfiles[] = {
+    {"v1.6.5-g9", ACSIP_FW_VERSION_V165G9, ACSIP_CAP_GPS_RESET | ACSIP_CAP_SET_KEYS | ACSIP_CAP_SATELLITE_HYBRID},
+    {"v1.6.6-g11", ACSIP_FW_VERSION_V166G11, ACSIP_CAP_GPS_LOW_POWER | ACSIP_CAP_SLEEP_GPS_LEVEL | ACSIP_CAP_SET_KEYS},
+};
+
+//Unknown firmware: try every command, keep the conservative command forms
+static const uint32_t unknownCaps = ACSIP_CAP_GPS_RESET | ACSIP_CAP_GPS_LOW_POWER |
+                                    ACSIP_CAP_SLEEP_GPS_LEVEL | ACSIP_CAP_SATELLITE_HYBRID;
+
+bool Acsip::begin(HardwareSerial &port, uint32_t maxBaud, const char *password)
 {
     isHardwareSerial = true;
     _port = &port;
     _timeout = DEFAULT_SERIAL_TIMEOUT;
+    _caps = unknownCaps;
+    _baud = 0;
+
+    uint32_t baud;
+    if (autoBaud(baud) != S7XG_OK) {
+        DEBUGLN("Module baud rate not detected");
+        return false;
+    }
+    if (maxBaud > baud) {
+        negotiateBaud(maxBaud, password);
+    }
 
     sendCmd("rf rx_con off");
     waitForAck(buffer, 2000);
@@ -272,19 +419,164 @@ bool Acsip::begin(HardwareSerial &port)
 
     reset();
 
-    String model = getModel();
-    if (model == "S76G" || model == "S78G") {
-        getVersion();
-        if (cmpstr("v1.6.6-g11")) {
-            version = ACSIP_FW_VERSION_V166G11;
-        } else if (cmpstr("v1.6.5-g9")) {
-            version = ACSIP_FW_VERSION_V165G9;
+    const char *model = getModel();
+    if (strcmp(model, "S76G") == 0 || strcmp(model, "S78G") == 0) {
+        const char *ver = getVersion();
+        version = ACSIP_FW_VERSION_UNKNOWN;
+        _caps = unknownCaps;
+        for (size_t i = 0; i < sizeof(fwProfiles) / sizeof(fwProfiles[0]); i++) {
+            if (strcmp(ver, fwProfiles[i].name) == 0) {
+                version = fwProfiles[i].version;
+                _caps = fwProfiles[i].caps;
+                break;
+            }
         }
         return true;
     }
     return false;
 }
 
+/*****************************************
+ *          BAUD RATE FUNCTION
+ ****************************************/
+void Acsip::setPortBaudRate(uint32_t baud)
+{
+    _port->flush();
+#if defined(ARDUINO_ARCH_ESP32)
+    //Keep the pin mapping given by the caller
+    _port->updateBaudRate(baud);
+#else
+    _port->begin(baud);
+#endif
+    while (_port->available()) {
+        _port->read();
+    }
+    _baud = baud;
+}
+
+bool Acsip::probe()
+{
+    waitIdle();
+    while (_port->available()) {
+        _port->read();
+    }
+    sendCmd("sip get_hw_model");
+    if (waitForAck(buffer, ACSIP_BAUD_PROBE_TIMEOUT) != S7XG_OK) {
+        return false;
+    }
+    return cmpstr("S76G") || cmpstr("S78G");
+}
+
+/**
+ * @brief  autoBaud
+ * @note   When the rate the port was started with is known it is tried first,
+ *         so a module that is already in sync costs a single round trip.
+ *         Otherwise the supported rates are swept so getBaudRate() is exact.
+ * @param  baud: detected baud rate
+ * @retval status code , see 'S7XG_Error' enum
+ */
+int Acsip::autoBaud(uint32_t &baud)
+{
+#if defined(ARDUINO_ARCH_ESP32)
+    //baudRate() reports the divider result, snap it to the nominal rate
+    uint32_t actual = _port->baudRate();
+    for (size_t i = 0; i < sizeof(baudRates) / sizeof(baudRates[0]); i++) {
+        uint32_t diff = actual > baudRates[i] ? actual - baudRates[i] : baudRates[i] - actual;
+        if (diff <= baudRates[i] / 50) {
+            _baud = baudRates[i];
+            break;
+        }
+    }
+#endif
+    if (_baud && probe()) {
+        baud = _baud;
+        return S7XG_OK;
+    }
+    for (size_t i = 0; i < sizeof(baudRates) / sizeof(baudRates[0]); i++) {
+        setPortBaudRate(baudRates[i]);
+        //The first frame after switching may be lost in the receiver
+        if (probe() || probe()) {
+            baud = _baud;
+            return S7XG_OK;
+        }
+    }
+    return S7XG_TIMEROUT;
+}
+
+int Acsip::ping(uint32_t timeout)
+{
+    uint32_t bytes = 0;
+    //Draining the port now would eat the reply of a queued command
+    waitIdle();
+    while (_port->available()) {
+        _port->read();
+    }
+    _rxLen = 0;
+    sendCmd("sip get_hw_model");
+    uint32_t start = millis();
+    while (millis() - start < timeout) {
+        if (!_port->available()) {
+            continue;
+        }
+        bytes++;
+        if (feed(_port->read())) {
+            _rxLen = 0;
+            return S7XG_OK;
+        }
+    }
+    _rxLen = 0;
+    return bytes ? S7XG_FAILED : S7XG_TIMEROUT;
+}
+
+/**
+ * @brief  negotiateBaud
+ * @note   The new rate is stored in the module EEPROM. If the module does not
+ *         answer at the new rate, the previous rate is restored, and as a last
+ *         resort the rate is detected again.
+ * @param  maxBaud: highest rate the host accepts
+ * @param  password: "sip set_baudrate" password
+ * @retval status code , see 'S7XG_Error' enum
+ */
+int Acsip::negotiateBaud(uint32_t maxBaud, const char *password)
+{
+    uint32_t current = _baud;
+    if (current == 0 && autoBaud(current) != S7XG_OK) {
+        return S7XG_FAILED;
+    }
+    for (size_t i = 0; i < sizeof(baudRates) / sizeof(baudRates[0]); i++) {
+        uint32_t rate = baudRates[i];
+        if (rate > maxBaud) {
+            continue;
+        }
+        if (rate <= current) {
+            return S7XG_OK;
+        }
+        //"Ok" may arrive at either rate, so only the probe at the new rate counts
+        snprintf(buffer, sizeof(buffer), "sip set_baudrate %u %s", rate, password);
+        sendCmd(buffer);
+        waitForAck(buffer, ACSIP_BAUD_PROBE_TIMEOUT);
+
+        setPortBaudRate(rate);
+        if (probe() || probe()) {
+            return S7XG_OK;
+        }
+        setPortBaudRate(current);
+        if (!probe()) {
+            uint32_t baud;
+            if (autoBaud(baud) != S7XG_OK) {
+                return S7XG_FAILED;
+            }
+            current = baud;
+        }
+    }
+    return S7XG_OK;
+}
+
+uint32_t Acsip::getBaudRate()
+{
+    return _baud;
+}
+
 /*****************************************
  *          SIP FUNCTION
  ****************************************/
@@ -297,6 +589,8 @@ void Acsip::reset()
     }
     _port->flush();
     _port->flush();
+    notify(ACSIP_STATE_IDLE);
+    notify(ACSIP_STATE_GPS_OFF);
 }
 
 const char *Acsip::getModel()
@@ -323,13 +617,17 @@ const char *Acsip::factoryReset()
 
 const char *Acsip::getVersion()
 {
-    sendCmd("sip get_ver");
-    if (waitForAck(buffer) == S7XG_OK) {
-        return buffer;
+    if (getVersion(_version, sizeof(_version)) == S7XG_OK) {
+        return _version;
     }
     return "Unkonw";
 }
 
+int Acsip::getVersion(char *ver, size_t size)
+{
+    return getString("sip get_ver", ver, size);
+}
+
 int Acsip::setEcho(bool on)
 {
     snprintf(buffer, sizeof(buffer), "sip set_echo %s", on ? "on" : "off");
@@ -344,6 +642,16 @@ int Acsip::setLog(int level)
     return universalSendCmd(buffer);
 }
 
+//"sip sleep" also puts a running GPS to sleep, gps_sleep_1 unless told otherwise
+void Acsip::notifySleep(uint32_t second, uint8_t gpsLevel)
+{
+    _gpsResume = _gpsState;
+    notify(ACSIP_STATE_SLEEP, second);
+    if (_gpsState != ACSIP_STATE_GPS_OFF) {
+        notify(gpsLevel == 2 ? ACSIP_STATE_GPS_DEEP_SLEEP : ACSIP_STATE_GPS_SLEEP);
+    }
+}
+
 /**
  * @brief  sleep
  * @note
@@ -360,11 +668,53 @@ int Acsip::sleep(uint32_t second, bool uratWake)
         return S7XG_FAILED;
     }
     if (strncmp(buffer, "sleep", 5) == 0) {
+        notifySleep(second, 1);
+        return S7XG_OK;
+    }
+    return S7XG_FAILED;
+}
+
+int Acsip::sleep(uint32_t second, bool uratWake, uint8_t gpsLevel)
+{
+    if (second % 10 || gpsLevel > 2) return S7XG_INVALD;
+    if (!hasCapability(ACSIP_CAP_SLEEP_GPS_LEVEL)) return S7XG_COMMAND_ERROR;
+    snprintf(buffer, sizeof(buffer), "sip sleep %u %s gps_sleep_%u", second, uratWake ? "uart_on" : "uart_off", gpsLevel);
+    sendCmd(buffer);
+    if (waitForAck(buffer) != S7XG_OK) {
+        return S7XG_FAILED;
+    }
+    if (strncmp(buffer, "sleep", 5) == 0) {
+        notifySleep(second, gpsLevel);
         return S7XG_OK;
     }
     return S7XG_FAILED;
 }
 
+int Acsip::wakeup(uint32_t timeout)
+{
+    if (!_port->available() || waitForAck(buffer, timeout) != S7XG_OK) {
+        _port->print("\n");
+        if (waitForAck(buffer, timeout) != S7XG_OK) {
+            return S7XG_TIMEROUT;
+        }
+    }
+    notify(ACSIP_STATE_IDLE);
+    if (_gpsState != _gpsResume) {
+        notify(_gpsResume);
+    }
+    return S7XG_OK;
+}
+
+int Acsip::getFirmwareVersion()
+{
+    return version;
+}
+
+bool Acsip::hasCapability(uint32_t cap)
+{
+    return (_caps & cap) == cap;
+}
+
 int Acsip::setBaudRate(uint32_t baud, const char *password)
 {
     snprintf(buffer, sizeof(buffer), "sip set_baudrate %u %s", baud, password);
@@ -373,13 +723,17 @@ int Acsip::setBaudRate(uint32_t baud, const char *password)
 
 const char *Acsip::getHardWareVer()
 {
-    sendCmd("sip get_hw_model_ver");
-    if (waitForAck(buffer) == S7XG_OK) {
-        return buffer;
+    if (getHardWareVer(_hwVersion, sizeof(_hwVersion)) == S7XG_OK) {
+        return _hwVersion;
     }
     return "Unkonw";
 }
 
+int Acsip::getHardWareVer(char *ver, size_t size)
+{
+    return getString("sip get_hw_model_ver", ver, size);
+}
+
 
 static const char grp[7] = {'A', 'B', 'C', 'D', 'E', 'F', 'H'};
 
@@ -412,27 +766,139 @@ bool Acsip::getGPIOValue(GPIOGroup group, int pin)
 }
 
 const char *Acsip::getUUID()
+{
+    if (getUUID(_uuid, sizeof(_uuid)) == S7XG_OK) {
+        return _uuid;
+    }
+    return "Unkonw";
+}
+
+int Acsip::getUUID(char *uuid, size_t size)
 {
     sendCmd("sip get_uuid");
-    if (waitForAck(buffer) == S7XG_OK) {
-        const char *uuid = strchr(buffer, '=');
-        if ( uuid == 0) {
-            return "Unkonw";
+    if (waitForAck(buffer) != S7XG_OK) {
+        return S7XG_TIMEROUT;
+    }
+    //uuid=002400413630373619473630
+    const char *ptr = strchr(buffer, '=');
+    if (ptr == NULL) {
+        return S7XG_FAILED;
+    }
+    if (strlen(ptr + 1) >= size) {
+        return S7XG_INVALD_LEN;
+    }
+    strcpy(uuid, ptr + 1);
+    return S7XG_OK;
+}
+
+int Acsip::setStorage(const uint8_t *data, uint32_t len)
+{
+    if (data == NULL || len == 0) {
+        return S7XG_INVALD_LEN;
+    }
+    //The image is a single argument, it can not hold blanks or line ends
+    for (uint32_t i = 0; i < len; i++) {
+        if (data[i] <= ' ' || data[i] > '~') {
+            return S7XG_INVALD;
         }
-        return uuid + 1;
     }
-    return "Unkonw";
+
+    sendCmd("sip set_storage ");
+    for (uint32_t i = 0; i < len; i += ACSIP_STORAGE_CHUNK) {
+        uint32_t n = len - i;
+        if (n > ACSIP_STORAGE_CHUNK) n = ACSIP_STORAGE_CHUNK;
+        _port->write(data + i, n);
+    }
+
+    if (waitForAck(buffer) != S7XG_OK) {
+        return S7XG_TIMEROUT;
+    }
+    if (cmpstr("Data format error") || cmpstr("Checksum format error")) {
+        return S7XG_INVALD;
+    } else if (strncmp(buffer, "Decrypted length", strlen("Decrypted length")) == 0) {
+        return S7XG_INVALD_LEN;
+    } else if (cmpstr("Not enough memory space")) {
+        //Module needs a "sip reset" before it can take the image
+        return S7XG_FAILED;
+    }
+    int ret = ackToError(buffer);
+    if (ret != S7XG_OK) {
+        return ret == S7XG_UNKONW ? S7XG_FAILED : ret;
+    }
+    return verifyStorage(data, len);
 }
 
-int Acsip::setStorage(uint8_t *buffer, uint32_t len)
+int Acsip::getStorage(uint8_t *data, uint32_t &len, uint32_t offset)
 {
-    // TODO :
+    uint32_t size, crc;
+    return readStorage(data, offset, len, size, crc);
+}
+
+int Acsip::getStorageSize(uint32_t &size)
+{
+    uint32_t len = 0, crc;
+    return readStorage(NULL, 0, len, size, crc);
+}
+
+int Acsip::verifyStorage(const uint8_t *data, uint32_t len)
+{
+    uint32_t copied = 0, size, crc;
+    int ret = readStorage(NULL, 0, copied, size, crc);
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    if (size != len || crc != crc32(data, len)) {
+        return S7XG_FAILED;
+    }
     return S7XG_OK;
 }
 
-int Acsip::getStorage(uint8_t *buffer, uint32_t &len)
+int Acsip::readStorage(uint8_t *data, uint32_t offset, uint32_t &len, uint32_t &size, uint32_t &crc)
 {
-    // TODO :
+    //The image does not fit the reply buffer, parse the frame byte by byte
+    static const char prefix[] = "\n\r>> ";
+    uint32_t limit = len;
+    uint8_t matched = 0;
+    char head[24];
+    uint32_t start = millis();
+
+    len = 0;
+    size = 0;
+    crc = 0;
+    sendCmd("sip get_storage");
+    while (1) {
+        if (millis() - start > _timeout) {
+            return S7XG_TIMEROUT;
+        }
+        if (!_port->available()) {
+            continue;
+        }
+        uint8_t c = _port->read();
+        if (matched < sizeof(prefix) - 1) {
+            matched = (c == (uint8_t)prefix[matched]) ? matched + 1 : (c == '\n');
+            continue;
+        }
+        if (c == '\n') {
+            break;
+        }
+        crc = crc32(&c, 1, crc);
+        if (size < sizeof(head) - 1) {
+            head[size] = c;
+        }
+        if (data && size >= offset && len < limit) {
+            data[len++] = c;
+        }
+        size++;
+    }
+    if (size == 0) {
+        return S7XG_FAILED;
+    }
+    if (size < sizeof(head)) {
+        //Short answers are errors, not an image
+        head[size] = '\0';
+        int ret = ackToError(head);
+        return ret == S7XG_UNKONW ? S7XG_OK : (ret == S7XG_OK ? S7XG_FAILED : ret);
+    }
     return S7XG_OK;
 }
 
@@ -447,70 +913,66 @@ int Acsip::getBatteryResistor(uint32_t &r1, uint32_t &r2)
     return getArgs("sip get_batt_resistor", "%u %u", &r1, &r2);
 }
 
+// "adc volt(..)" only comes first once the battery resistors are set
+static const char *const battMore[] = {"adc volt", NULL};
+static const AcsipToken battDone[] = {
+    {"battery volt", S7XG_OK},
+    {NULL, 0},
+};
+static const AcsipResponseSpec battSpec = {2, battDone, battMore, S7XG_FAILED};
+
 int Acsip::getBatteryVoltage(uint16_t &volt)
 {
-    char *ch = NULL;
-    char strr[32] = {0};
+    AcsipResponse rsp;
     sendCmd("sip get_batt_volt");
-
-    if (waitForAck(buffer) != S7XG_OK) {
-        return S7XG_TIMEROUT;
-    }
-
-    if (strncmp(buffer, "adc volt", strlen("adc volt")) == 0) {
-        if (waitForAck(buffer) != S7XG_OK) {
-            return S7XG_TIMEROUT;
-        }
-        if (strncmp(buffer, "battery volt", strlen("battery volt")) == 0) {
-            char *ptr = buffer + strlen("battery volt") + 1;
-            ch = strchr(ptr, ' ');
-            if (ch == NULL)return S7XG_FAILED;
-            memcpy(strr, ptr, ch - ptr);
-            volt = atoi(strr);
-            return S7XG_OK;
-        }
-    } else if (strncmp(buffer, "battery volt", strlen("battery volt")) == 0) {
-        char *ptr = buffer + strlen("battery volt") + 1;
-        ch = strchr(ptr, ' ');
-        if (ch == NULL)return S7XG_FAILED;
-        memcpy(strr, ptr, ch - ptr);
-        volt = atoi(strr);
-        return S7XG_OK;
+    int ret = collect(battSpec, rsp);
+    if (ret != S7XG_OK) {
+        return ret;
     }
-
-
-    return S7XG_FAILED;
+    const char *ptr = rsp.last() + strlen("battery volt") + 1;
+    if (strchr(ptr, ' ') == NULL)return S7XG_FAILED;
+    volt = atoi(ptr);
+    return S7XG_OK;
 }
 
 /*****************************************
  *          MAC FUNCTION
  ****************************************/
 
+// "Ok" first, the join result once the procedure ends
+static const char *const okMore[] = {"Ok", NULL};
+static const AcsipToken joinDone[] = {
+    {"accepted", S7XG_OK},
+    {"unsuccess", S7XG_TIMEROUT},
+    {"Invalid", S7XG_FAILED},
+    {"keys_not_init", S7XG_FAILED},
+    {"no_free_ch", S7XG_FAILED},
+    {"busy", S7XG_FAILED},
+    {NULL, 0},
+};
+//Like the old reader, anything but "accepted" after "Ok" is a failed join
+static const AcsipResponseSpec joinSpec = {2, joinDone, okMore, S7XG_TIMEROUT};
+
+int Acsip::joinToError(const char *ack)
+{
+    for (const AcsipToken *t = joinDone; t->prefix; t++) {
+        if (matchToken(ack, t->prefix)) {
+            return t->err;
+        }
+    }
+    return joinSpec.unexpected;
+}
+
 int Acsip::join(const char *type)
 {
+    AcsipResponse rsp;
     snprintf(buffer, sizeof(buffer), "mac join %s", type);
     sendCmd(buffer);
-    if (waitForAck(buffer) != S7XG_OK) {
-        return S7XG_TIMEROUT;
-    }
-    if (cmpstr("Ok")) {
-        if (waitForAck(buffer) != S7XG_OK) {
-            return S7XG_TIMEROUT;
-        }
-        if (cmpstr("accepted")) {
-            return S7XG_OK;
-        }
-        return S7XG_TIMEROUT;
-    } else if (cmpstr("Invalid")) {
-        return S7XG_FAILED;
-    } else if (cmpstr("keys_not_init")) {
-        return S7XG_FAILED;
-    } else if (cmpstr("no_free_ch")) {
-        return S7XG_FAILED;
-    } else if (cmpstr("busy")) {
-        return S7XG_FAILED;
-    }
-    return S7XG_OK;
+    //Join request: MHDR, AppEUI, DevEUI, DevNonce and MIC
+    notify(ACSIP_STATE_UPLINK, 23);
+    int ret = collect(joinSpec, rsp);
+    notify(ACSIP_STATE_IDLE);
+    return ret;
 }
 
 
@@ -525,6 +987,21 @@ int Acsip::joinABP()
 }
 
 
+// "Ok" first, then the result of the uplink or a downlink
+static const AcsipToken txDone[] = {
+    {"tx_ok", S7XG_OK},
+    {"mac rx", S7XG_OK},
+    {"err", S7XG_FAILED},
+    {"Invalid", S7XG_INVALD},
+    {"not_joined", S7XG_UNJOINED},
+    {"no_free_ch", S7XG_FAILED},
+    {"busy", S7XG_BUSY},
+    {"invalid_data_length", S7XG_INVALD_LEN},
+    {"exceeded_data_length", S7XG_INVALD_LEN},
+    {NULL, 0},
+};
+static const AcsipResponseSpec txSpec = {2, txDone, okMore, S7XG_OK};
+
 int Acsip::send(uint8_t port, uint8_t *data, size_t len, uint8_t type)
 {
     if (port < 1 || port > 223)return S7XG_INVALD;
@@ -532,6 +1009,7 @@ int Acsip::send(uint8_t port, uint8_t *data, size_t len, uint8_t type)
     snprintf(buffer, sizeof(buffer), "mac tx %s %d ", type ? "ucnf" : "cnf", port);
     DEBUG("Send->  ");
     DEBUG(buffer);
+    waitIdle();
     _port->print(buffer);
     for (size_t i = 0; i < len; i++) {
         if ((data[i] & 0xF0) == 0) {
@@ -548,32 +1026,12 @@ int Acsip::send(uint8_t port, uint8_t *data, size_t len, uint8_t type)
     DEBUGLN();
     DEBUGLN();
 
-    if (waitForAck(buffer) != S7XG_OK) {
-        return S7XG_TIMEROUT;
-    }
-    if (cmpstr("Ok")) {
-        if (waitForAck(buffer) != S7XG_OK) {
-            return S7XG_TIMEROUT;
-        }
-        if (cmpstr("tx_ok")) {
-            DEBUGLN("TX_OK");
-            return S7XG_OK;
-        } else if (cmpstr("err")) {
-            DEBUGLN("TX_ERR");
-            return S7XG_FAILED;
-        }
-    } else if (cmpstr("Invalid")) {
-        return S7XG_INVALD;
-    } else if (cmpstr("not_joined")) {
-        return S7XG_UNJOINED;
-    } else if (cmpstr("busy")) {
-        return S7XG_BUSY;
-    } else if (cmpstr("invalid_data_length")) {
-        return S7XG_INVALD_LEN;
-    } else if (cmpstr("exceeded_data_length")) {
-        return S7XG_INVALD_LEN;
-    }
-    return S7XG_OK;
+    //MHDR, FHDR, FPort and MIC around the payload
+    notify(ACSIP_STATE_UPLINK, len + 13);
+    AcsipResponse rsp;
+    int ret = collect(txSpec, rsp);
+    notify(ACSIP_STATE_IDLE);
+    return ret;
 }
 
 
@@ -791,6 +1249,11 @@ int Acsip::getAppKey(String &key)
     return S7XG_OK;
 }
 
+int Acsip::getAppKey(char *key, size_t size)
+{
+    return getString("mac get_appkey", key, size);
+}
+
 int Acsip::getAppSessionKey(String &key)
 {
     sendCmd("mac get_appskey");
@@ -801,6 +1264,11 @@ int Acsip::getAppSessionKey(String &key)
     return S7XG_OK;
 }
 
+int Acsip::getAppSessionKey(char *key, size_t size)
+{
+    return getString("mac get_appskey", key, size);
+}
+
 int Acsip::getNetworkSessionKey(String &key)
 {
     sendCmd("mac get_nwkskey");
@@ -811,6 +1279,11 @@ int Acsip::getNetworkSessionKey(String &key)
     return S7XG_OK;
 }
 
+int Acsip::getNetworkSessionKey(char *key, size_t size)
+{
+    return getString("mac get_nwkskey", key, size);
+}
+
 int Acsip::getAppEui(String &eui)
 {
     sendCmd("mac get_appeui");
@@ -821,6 +1294,11 @@ int Acsip::getAppEui(String &eui)
     return S7XG_OK;
 }
 
+int Acsip::getAppEui(char *eui, size_t size)
+{
+    return getString("mac get_appeui", eui, size);
+}
+
 int Acsip::getDevEui(String &eui)
 {
     sendCmd("mac get_deveui");
@@ -831,6 +1309,11 @@ int Acsip::getDevEui(String &eui)
     return S7XG_OK;
 }
 
+int Acsip::getDevEui(char *eui, size_t size)
+{
+    return getString("mac get_deveui", eui, size);
+}
+
 int Acsip::getDevAddr(String &addr)
 {
     sendCmd("mac get_devaddr");
@@ -841,20 +1324,42 @@ int Acsip::getDevAddr(String &addr)
     return S7XG_OK;
 }
 
-int Acsip::getJoinChannel()
+int Acsip::getDevAddr(char *addr, size_t size)
+{
+    return getString("mac get_devaddr", addr, size);
+}
+
+int Acsip::getJoinChannel()
+{
+    //TODO:
+    return S7XG_OK;
+}
+
+int Acsip::getUplinkCounter(uint32_t &count)
+{
+    return getUnit("mac get_upcnt", count);
+}
+
+int Acsip::getDownLinkCounter(uint32_t &count)
+{
+    return getUnit("mac get_downcnt", count);
+}
+
+int Acsip::setUplinkCounter(uint32_t count)
 {
-    //TODO:
-    return S7XG_OK;
+    snprintf(buffer, sizeof(buffer), "mac set_upcnt %u", count);
+    return universalSendCmd(buffer);
 }
 
-int Acsip::getUplinkCounter(uint32_t &count)
+int Acsip::setDownLinkCounter(uint32_t count)
 {
-    return getUnit("mac get_upcnt", count);
+    snprintf(buffer, sizeof(buffer), "mac set_downcnt %u", count);
+    return universalSendCmd(buffer);
 }
 
-int Acsip::getDownLinkCounter(uint32_t &count)
+int Acsip::setMacSave()
 {
-    return getUnit("mac get_downcnt", count);
+    return universalSendCmd("mac save");
 }
 
 
@@ -964,6 +1469,26 @@ int Acsip::getChannelCount(uint8_t &count)
     return getUnit("mac get_ch_count", count);
 }
 
+int Acsip::setOTAAKeys(const char *devEui, const char *appEui, const char *appKey)
+{
+    //"mac set_keys" writes all six keys to EEPROM and has no "unchanged"
+    //value, so a partial key set always goes through the single setters
+    int ret = setDevEui(devEui);
+    if (ret != S7XG_OK) return ret;
+    ret = setAppEui(appEui);
+    if (ret != S7XG_OK) return ret;
+    return setAppKey(appKey);
+}
+
+int Acsip::setABPKeys(const char *devAddr, const char *appsKey, const char *nwksKey)
+{
+    int ret = setDevAddr(devAddr);
+    if (ret != S7XG_OK) return ret;
+    ret = setAppSessionKey(appsKey);
+    if (ret != S7XG_OK) return ret;
+    return setNetworkSessionKey(nwksKey);
+}
+
 int Acsip::setKeys(const char *devAddr,
                    const char *devEui,
                    const char *appEui,
@@ -1102,45 +1627,80 @@ int Acsip::setRfFreqDeviation(uint16_t dev)
 int Acsip::setReceiveContinuous(bool en)
 {
     snprintf(buffer, sizeof(buffer), "rf rx_con %s", en ? "on" : "off");
-    return universalSendCmd(buffer);
+    int ret = universalSendCmd(buffer);
+    if (ret == S7XG_OK) {
+        notify(en ? ACSIP_STATE_RX_CONTINUOUS : ACSIP_STATE_IDLE);
+    }
+    return ret;
 }
 
 int Acsip::RfSendString(const char *str)
 {
-    int i = 0;
-    char hex[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-    char *ascii = (char *)calloc(strlen(str) * 3 + 1, sizeof(char));
-    if (ascii == NULL) {
-        return S7XG_FAILED;
-    }
-    while ( i < strlen(str) ) {
-        int c = str[i] & 0x000000ff;
-        ascii[i * 2] = hex[c / 16] ;
-        ascii[i * 2 + 1] = hex[c % 16] ;
-        ++i;
-    }
-    int ret = RfSend(ascii);
-    free(ascii);
-    return ret;
+    //Hex encoded on the fly, no temporary copy
+    return RfSend((const uint8_t *)str, strlen(str));
 }
 
+// "Ok" first, then the result of the transmission
+static const AcsipToken rfTxDone[] = {
+    {"radio_tx_ok", S7XG_OK},
+    {"radio_err", S7XG_FAILED},
+    {"Invalid", S7XG_INVALD},
+    {NULL, 0},
+};
+static const AcsipResponseSpec rfTxSpec = {2, rfTxDone, okMore, S7XG_FAILED};
+
 int Acsip::RfSend(char *hexData)
 {
+    AcsipResponse rsp;
     snprintf(buffer, sizeof(buffer), "rf tx %s", hexData);
     sendCmd(buffer);
-    if (waitForAck(buffer) != S7XG_OK) {
-        return S7XG_TIMEROUT;
+    notify(ACSIP_STATE_TX, strlen(hexData) / 2);
+    int ret = collect(rfTxSpec, rsp);
+    notify(ACSIP_STATE_IDLE);
+    return ret;
+}
+
+int Acsip::RfSend(const uint8_t *data, size_t len)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    if (len == 0 || len > 255) return S7XG_INVALD_LEN;
+    waitIdle();
+    _port->print("rf tx ");
+    for (size_t i = 0; i < len; i++) {
+        _port->print(hex[data[i] >> 4]);
+        _port->print(hex[data[i] & 0x0F]);
     }
-    if (cmpstr("Ok")) {
-        if (waitForAck(buffer) != S7XG_OK) {
-            return S7XG_TIMEROUT;
-        }
-        if (cmpstr("radio_tx_ok")) {
-            return S7XG_OK;
-        }
-        return S7XG_OK;
+    notify(ACSIP_STATE_TX, len);
+    AcsipResponse rsp;
+    int ret = collect(rfTxSpec, rsp);
+    notify(ACSIP_STATE_IDLE);
+    return ret;
+}
+
+// "Ok" first, then a packet or the end of the receive window
+static const AcsipToken rfRxDone[] = {
+    {"radio_rx", S7XG_OK},
+    {"Invalid", S7XG_INVALD},
+    {NULL, 0},
+};
+static const AcsipResponseSpec rfRxSpec = {2, rfRxDone, okMore, S7XG_TIMEROUT};
+
+int Acsip::RfReceive(uint8_t *data, size_t &len, int &rssi, int &snr, uint16_t window)
+{
+    AcsipResponse rsp;
+    size_t size = len;
+    len = 0;
+    if (window == 0) return S7XG_INVALD;
+    snprintf(buffer, sizeof(buffer), "rf rx %u", window);
+    sendCmd(buffer);
+    notify(ACSIP_STATE_RX);
+    int ret = collect(rfRxSpec, rsp, _timeout + window);
+    notify(ACSIP_STATE_IDLE);
+    if (ret != S7XG_OK) {
+        return ret;
     }
-    return S7XG_FAILED;
+    //The frame lives in the command buffer, decode it in place
+    return parseRadioRx((char *)rsp.last(), data, size, len, rssi, snr);
 }
 
 int Acsip::getRfFreq(uint32_t &freq)
@@ -1169,14 +1729,39 @@ int Acsip::setLevelShift(bool on)
     return universalSendCmd(buffer);
 }
 
-int Acsip::setMode(GPSMode mode)
+const char *Acsip::gpsModeName(GPSMode mode)
 {
     static const char *gpsMode[] = {
         "auto", "manual", "idle"
     };
+    return mode < S7XG_GPS_MODE_MAX ? gpsMode[mode] : NULL;
+}
+
+const char *Acsip::gpsStartName(GPSStartMode type)
+{
+    static const char *start[] = {
+        "hot", "warm", "cold"
+    };
+    return type < S7XG_GPS_START_MAX ? start[type] : NULL;
+}
+
+const char *Acsip::satelliteName(GPSSatelliteSys type)
+{
+    if (type >= S7XG_SATELLITE_MAX) return NULL;
+    //G11 renamed "hybrid" to "gps_glonass"
+    if (type == S7XG_SATELLITE_GPS) return "gps";
+    return hasCapability(ACSIP_CAP_SATELLITE_HYBRID) ? "hybrid" : "gps_glonass";
+}
+
+int Acsip::setMode(GPSMode mode)
+{
     if (mode >= S7XG_GPS_MODE_MAX)return S7XG_INVALD;
-    snprintf(buffer, sizeof(buffer), "gps set_mode %s", gpsMode[mode]);
-    return universalSendCmd(buffer);
+    snprintf(buffer, sizeof(buffer), "gps set_mode %s", gpsModeName(mode));
+    int ret = universalSendCmd(buffer);
+    if (ret == S7XG_OK) {
+        notify(mode == S7XG_GPS_MODE_IDLE ? ACSIP_STATE_GPS_OFF : ACSIP_STATE_GPS_ACTIVE);
+    }
+    return ret;
 }
 
 int Acsip::setPortUplink(uint8_t port)
@@ -1205,21 +1790,15 @@ int Acsip::setPositioningCycle(uint32_t cycle)
 
 int Acsip::setSatelliteSystem(GPSSatelliteSys type)
 {
-    static const char *system[] = {
-        "gps", "hybrid"
-    };
     if (type >= S7XG_SATELLITE_MAX)return S7XG_INVALD;
-    snprintf(buffer, sizeof(buffer), "gps set_satellite_system %s", system[type]);
+    snprintf(buffer, sizeof(buffer), "gps set_satellite_system %s", satelliteName(type));
     return universalSendCmd(buffer);
 }
 
 int Acsip::setStart(GPSStartMode type)
 {
-    static const char *start[] = {
-        "hot", "warm", "cold"
-    };
     if (type >= S7XG_GPS_START_MAX)return S7XG_INVALD;
-    snprintf(buffer, sizeof(buffer), "gps set_start %s", start[type]);
+    snprintf(buffer, sizeof(buffer), "gps set_start %s", gpsStartName(type));
     return universalSendCmd(buffer);
 }
 
@@ -1322,7 +1901,11 @@ int Acsip::getMode(GPSModeStruct &data)
     }
 
     //! Satellite_System
-    if (strncmp(ptr, "gps", strlen("gps")) == 0) {
+    if (strncmp(ptr, "gps_glonass", strlen("gps_glonass")) == 0) {
+        DEBUGLN("gps_glonass");
+        ptr += strlen("gps_glonass") + 1;
+        data.sys = S7XG_SATELLITE_GPS_GLONASS;
+    } else if (strncmp(ptr, "gps", strlen("gps")) == 0) {
         DEBUGLN("gps");
         ptr += strlen("gps") + 1;
         data.sys = S7XG_SATELLITE_GPS;
@@ -1346,32 +1929,51 @@ int Acsip::getMode(GPSModeStruct &data)
 
 int Acsip::getTtff(float &second)
 {
-    return getArgs("gps get_mode", "%fs", &second);
+    return getArgs("gps get_ttff", "%fs", &second);
 }
 
 int Acsip::gpsReset()
 {
+    if (!hasCapability(ACSIP_CAP_GPS_RESET)) return S7XG_COMMAND_ERROR;
     return universalSendCmd("gps reset");
 }
 
+int Acsip::setGPSLowPower(bool on)
+{
+    if (!hasCapability(ACSIP_CAP_GPS_LOW_POWER)) return S7XG_COMMAND_ERROR;
+    snprintf(buffer, sizeof(buffer), "gps set_low_power %s", on ? "on" : "off");
+    return universalSendCmd(buffer);
+}
+
 int Acsip::gpsSleep()
 {
-    return universalSendCmd("gps sleep on 0");
+    int ret = universalSendCmd("gps sleep on 0");
+    if (ret == S7XG_OK) {
+        notify(ACSIP_STATE_GPS_SLEEP);
+    }
+    return ret;
 }
 
 int Acsip::gpsDeepSleep()
 {
-    return universalSendCmd("gps sleep on 1");
+    int ret = universalSendCmd("gps sleep on 1");
+    if (ret == S7XG_OK) {
+        notify(ACSIP_STATE_GPS_DEEP_SLEEP);
+    }
+    return ret;
 }
 
 int Acsip::gpsWakeup()
 {
-    return universalSendCmd("gps sleep off");
+    int ret = universalSendCmd("gps sleep off");
+    if (ret == S7XG_OK) {
+        notify(ACSIP_STATE_GPS_ACTIVE);
+    }
+    return ret;
 }
 
 int Acsip::getData( GPSDataStruct &data, GPSDataType type)
 {
-    int ret = 0;
     static const char *gpsType[] = {
         "raw", "dd", "dms"
     };
@@ -1383,26 +1985,38 @@ int Acsip::getData( GPSDataStruct &data, GPSDataType type)
     if (waitForAck(buffer) != S7XG_OK) {
         return S7XG_TIMEROUT;
     }
-    //TODO:
-    if (strncmp(buffer, "POSITIONING", strlen("POSITIONING")) == 0) {
-        const char *c = strchr(buffer, '(');
+    int ret = parseGPSData(buffer, data, type);
+    if (ret == S7XG_OK && data.isValid) {
+        GPSData = data;
+    }
+    return ret;
+}
+
+int Acsip::parseGPSData(const char *ack, GPSDataStruct &data, GPSDataType type)
+{
+    int ret = 0;
+    data.isValid = false;
+    data.type = type;
+    data.timestamp = millis();
+    if (strncmp(ack, "POSITIONING", strlen("POSITIONING")) == 0) {
+        const char *c = strchr(ack, '(');
         if (c != NULL) {
-            sscanf(buffer, "POSITIONING ( %fs )", &data.second);
+            sscanf(ack, "POSITIONING ( %fs )", &data.second);
         }
         return S7XG_OK;
-    } else if (cmpstr("gps_not_init") ) {
+    } else if (strcmp(ack, "gps_not_init") == 0 ) {
         DEBUGLN("gps_not_init");
         return S7XG_GPS_NOT_INIT;
-    } else if (cmpstr("gps_in_idle")) {
+    } else if (strcmp(ack, "gps_in_idle") == 0) {
         DEBUGLN("gps_in_idle");
         return S7XG_FAILED;
-    } else if (cmpstr("gps_not_positioning")) {
+    } else if (strcmp(ack, "gps_not_positioning") == 0) {
         return S7XG_FAILED;
     }
 
     switch (type) {
     case S7XG_GPS_DATA_RAW:
-        ret = sscanf(buffer, GPS_RAW_FORMAT,
+        ret = sscanf(ack, GPS_RAW_FORMAT,
                      &data.raw.datetime.year,
                      &data.raw.datetime.month,
                      &data.raw.datetime.day,
@@ -1426,7 +2040,7 @@ int Acsip::getData( GPSDataStruct &data, GPSDataType type)
 #endif
         break;
     case S7XG_GPS_DATA_DD:
-        ret = sscanf(buffer, GPS_DD_FORMAT,
+        ret = sscanf(ack, GPS_DD_FORMAT,
                      &data.dd.datetime.year,
                      &data.dd.datetime.month,
                      &data.dd.datetime.day,
@@ -1451,7 +2065,7 @@ int Acsip::getData( GPSDataStruct &data, GPSDataType type)
 #endif
         break;
     case S7XG_GPS_DATA_DMS:
-        ret = sscanf(buffer, GPS_DMS_FORMAT,
+        ret = sscanf(ack, GPS_DMS_FORMAT,
                      &data.dms.datetime.year,
                      &data.dms.datetime.month,
                      &data.dms.datetime.day,
@@ -1484,6 +2098,63 @@ int Acsip::getData( GPSDataStruct &data, GPSDataType type)
     return S7XG_OK;
 }
 
+void Acsip::setGPSPollInterval(uint32_t ms, GPSDataType type)
+{
+    _gpsInterval = ms;
+    _gpsType = type < S7XG_GPS_DATA_MAX ? type : S7XG_GPS_DATA_DD;
+    _gpsLastPoll = millis() - ms;
+}
+
+void Acsip::updateGPS(const GPSDataStruct &data)
+{
+    if (data.isValid) {
+        GPSData = data;
+    }
+}
+
+uint32_t Acsip::getFixAge()
+{
+    if (!GPSData.isValid) {
+        return UINT32_MAX;
+    }
+    return millis() - GPSData.timestamp;
+}
+
+void Acsip::toDegrees(const GPSDataStruct &data, double &lat, double &lng)
+{
+    int deg;
+    switch (data.type) {
+    case S7XG_GPS_DATA_RAW:
+        //ddmm.mmmm
+        deg = (int)(data.raw.lat / 100);
+        lat = deg + (data.raw.lat - deg * 100) / 60.0;
+        deg = (int)(data.raw.lng / 100);
+        lng = deg + (data.raw.lng - deg * 100) / 60.0;
+        break;
+    case S7XG_GPS_DATA_DMS:
+        lat = data.dms.lat.dd + data.dms.lat.mm / 60.0 + data.dms.lat.ss / 3600.0;
+        lng = data.dms.lng.dd + data.dms.lng.mm / 60.0 + data.dms.lng.ss / 3600.0;
+        break;
+    default:
+        lat = data.dd.lat;
+        lng = data.dd.lng;
+        break;
+    }
+}
+
+void Acsip::gpsPollDone(void *arg, int err, const char *ack)
+{
+    Acsip *self = (Acsip *)arg;
+    self->_gpsPolling = false;
+    if (err != S7XG_OK) {
+        return;
+    }
+    GPSDataStruct data;
+    if (self->parseGPSData(ack, data, self->_gpsType) == S7XG_OK) {
+        self->updateGPS(data);
+    }
+}
+
 int Acsip::GPSStart(GPSStartMode type, GPSMode mode, GPSSatelliteSys satellite, uint32_t cycle)
 {
     int ret  = 0;
@@ -1531,63 +2202,498 @@ void Acsip::setRFCallback(rf_callback cb)
     _rf_callback = cb;
 }
 
+void Acsip::setStateCallback(acsip_state_callback cb, void *arg)
+{
+    _state_callback = cb;
+    _state_arg = arg;
+}
+
 int Acsip::service()
 {
-    int rssi = 0, snr = 0;
-    bool rxdone = false;
-    char *ptr = NULL;
-    char *str = NULL;
-    uint8_t serial_buffer[256] = {0};
-    int buffer_size = sizeof(serial_buffer);
-    int i = 0;
-    int offset = 0;
-
-    while (_port->available() && i < buffer_size) {
-        serial_buffer[i] = _port->read();
-        if (serial_buffer[0] == 0xA && serial_buffer[1] == 0xD &&
-                serial_buffer[2] == 0x3E && serial_buffer[3] == 0x3E
-                && serial_buffer[i] == 0xA) {
-            ptr = strndup((const char *)&serial_buffer[5], i - 6);
-            // Serial.printf("Recvicer Done .. [size:%d] -> %s\n", i - 6, ptr);
-            rxdone = true;
+    //One frame per call, decoded in the RX arena without allocating
+    while (_port->available()) {
+        if (feed(_port->read())) {
+            if (rf_check_available(&_rx[5])) {
+                dispatchFrame(&_rx[5]);
+            }
+            _rxLen = 0;
             break;
         }
-        ++i;
     }
+    return 0;
+}
 
-    if (!rxdone) {
-        return 0;
+
+/*****************************************
+ *          ASYNC FUNCTION
+ ****************************************/
+int Acsip::submit(const char *cmd, acsip_callback cb, void *arg, uint8_t frames, uint32_t timeout)
+{
+    if (_count >= ACSIP_QUEUE_SIZE) {
+        return S7XG_QUEUE_FULL;
+    }
+    if (strlen(cmd) >= ACSIP_REQUEST_SIZE) {
+        return S7XG_INVALD_LEN;
+    }
+    AcsipRequest &req = _queue[(_head + _count) % ACSIP_QUEUE_SIZE];
+    strcpy(req.cmd, cmd);
+    req.frames = frames ? frames : 1;
+    req.timeout = timeout;
+    req.cb = cb;
+    req.arg = arg;
+    _count++;
+    return S7XG_OK;
+}
+
+struct BatchState {
+    acsip_batch_sink    sink;
+    void               *arg;
+    uint16_t            done;
+    int                 err;
+};
+
+//Replies complete in queue order, so 'done' is the index of this reply
+static void batchDone(void *arg, int err, const char *ack)
+{
+    BatchState *s = (BatchState *)arg;
+    if (err == S7XG_OK) {
+        err = s->sink ? s->sink(s->arg, s->done, ack) : Acsip::ackToError(ack);
     }
+    if (s->err == S7XG_OK) {
+        s->err = err;
+    }
+    s->done++;
+}
+
+int Acsip::batch(uint16_t count, acsip_batch_source source, acsip_batch_sink sink, void *arg)
+{
+    BatchState s = {sink, arg, 0, S7XG_OK};
+    uint16_t next = 0;
 
-    if (rf_check_available(ptr) && _rf_callback) {
+    while (s.done < next || (next < count && s.err == S7XG_OK)) {
+        while (next < count && s.err == S7XG_OK && _count < ACSIP_QUEUE_SIZE) {
+            //Built in place in the free queue slot, no command copy on the stack
+            AcsipRequest &req = _queue[(_head + _count) % ACSIP_QUEUE_SIZE];
+            int ret = source(arg, next, req.cmd, sizeof(req.cmd));
+            if (ret != S7XG_OK) {
+                s.err = ret;
+                break;
+            }
+            req.frames = 1;
+            req.timeout = 0;
+            req.cb = batchDone;
+            req.arg = &s;
+            _count++;
+            next++;
+        }
+        process();
+    }
+    return s.err;
+}
 
-        char *rf_prt = ptr + 9;
-        str = strrchr(rf_prt, 0x20);
-        if (str == NULL) {
-            goto exit;
+/*****************************************
+ *          SNAPSHOT
+ ****************************************/
+#define SNAP_AT(m)              offsetof(AcsipSnapshot, m), sizeof(((AcsipSnapshot *)0)->m)
+#define SNAP_SPAN(first, last)  offsetof(AcsipSnapshot, first), \
+                                offsetof(AcsipSnapshot, last) + sizeof(((AcsipSnapshot *)0)->last) - offsetof(AcsipSnapshot, first)
+
+//Entry n is field bit n, offset and size locate its bytes for the change check
+static const struct {
+    const char *cmd;
+    uint8_t     offset;
+    uint8_t     size;
+} snapFields[] = {
+    {"mac get_band", SNAP_AT(band)},
+    {"mac get_adr", SNAP_AT(adr)},
+    {"mac get_dr", SNAP_AT(dataRate)},
+    {"mac get_power", SNAP_AT(power)},
+    {"mac get_rx2", SNAP_SPAN(rx2DataRate, rx2Freq)},
+    {"mac get_rxdelay", SNAP_SPAN(rx1Delay, rx2Delay)},
+    {"mac get_txretry", SNAP_AT(txRetry)},
+    {"mac get_upcnt", SNAP_AT(uplinkCounter)},
+    {"mac get_downcnt", SNAP_AT(downlinkCounter)},
+    {"mac get_ch_count", SNAP_AT(channelCount)},
+    {"mac get_class", SNAP_AT(devClass)},
+    {"mac get_join_status", SNAP_AT(joined)},
+    {"mac get_dc_ctl", SNAP_AT(dutyCycle)},
+    {"mac get_tx_confirm", SNAP_AT(txConfirm)},
+    {"mac get_sync", SNAP_AT(sync)},
+    {"mac get_deveui", SNAP_AT(devEui)},
+    {"mac get_appeui", SNAP_AT(appEui)},
+    {"mac get_appkey", SNAP_AT(appKey)},
+    {"mac get_devaddr", SNAP_AT(devAddr)},
+    {"mac get_nwkskey", SNAP_AT(nwksKey)},
+    {"mac get_appskey", SNAP_AT(appsKey)},
+    {"sip get_ver", SNAP_AT(version)},
+    {"sip get_hw_model_ver", SNAP_AT(hwVersion)},
+    {"sip get_uuid", SNAP_AT(uuid)},
+    {"sip get_batt_volt", SNAP_AT(battery)},
+};
+
+static_assert(sizeof(AcsipSnapshot) <= 256, "snapFields offsets are 8 bit");
+static_assert(ACSIP_SNAP_ALL == (1UL << (sizeof(snapFields) / sizeof(snapFields[0]))) - 1,
+              "one snapFields entry per AcsipSnapshotField bit");
+
+static bool hexToBytes(const char *hex, uint8_t *dst, size_t size)
+{
+    if (strlen(hex) != size * 2) {
+        return false;
+    }
+    for (size_t i = 0; i < size; i++) {
+        char byte[3] = {hex[2 * i], hex[2 * i + 1], '\0'};
+        if (!isxdigit(byte[0]) || !isxdigit(byte[1])) {
+            return false;
         }
-        offset = str - rf_prt;
-        snr = atoi(str + 1);
-        rf_prt[offset] = 0;
+        dst[i] = strtoul(byte, NULL, 16);
+    }
+    return true;
+}
+
+static bool parseOnOff(const char *ack, const char *on, const char *off, bool &value)
+{
+    value = strcmp(ack, on) == 0;
+    return value || strcmp(ack, off) == 0;
+}
+
+//Parse the answer of snapFields[field], the members are packed so go through locals
+static bool parseSnapField(uint8_t field, const char *ack, AcsipSnapshot &snap)
+{
+    unsigned int a, b;
+    int n;
+    bool on;
+    switch (field) {
+    case 0:
+        if (sscanf(ack, "%u", &a) != 1) return false;
+        snap.band = a;
+        return true;
+    case 1:
+        if (!parseOnOff(ack, "on", "off", on)) return false;
+        snap.adr = on;
+        return true;
+    case 2:
+        if (sscanf(ack, "%u", &a) != 1) return false;
+        snap.dataRate = a;
+        return true;
+    case 3:
+        if (sscanf(ack, "%d", &n) != 1) return false;
+        snap.power = n;
+        return true;
+    case 4:
+        if (sscanf(ack, "%u %u", &a, &b) != 2) return false;
+        snap.rx2DataRate = a;
+        snap.rx2Freq = b;
+        return true;
+    case 5:
+        if (sscanf(ack, "%u %u", &a, &b) != 2) return false;
+        snap.rx1Delay = a;
+        snap.rx2Delay = b;
+        return true;
+    case 6:
+        if (sscanf(ack, "%u", &a) != 1) return false;
+        snap.txRetry = a;
+        return true;
+    case 7:
+        if (sscanf(ack, "%u", &a) != 1) return false;
+        snap.uplinkCounter = a;
+        return true;
+    case 8:
+        if (sscanf(ack, "%u", &a) != 1) return false;
+        snap.downlinkCounter = a;
+        return true;
+    case 9:
+        if (sscanf(ack, "%u", &a) != 1) return false;
+        snap.channelCount = a;
+        return true;
+    case 10:
+        if (ack[0] != 'A' && ack[0] != 'C') return false;
+        snap.devClass = ack[0];
+        return true;
+    case 11:
+        if (!parseOnOff(ack, "joined", "unjoined", on)) return false;
+        snap.joined = on;
+        return true;
+    case 12:
+        if (!parseOnOff(ack, "on", "off", on)) return false;
+        snap.dutyCycle = on;
+        return true;
+    case 13:
+        if (!parseOnOff(ack, "on", "off", on)) return false;
+        snap.txConfirm = on;
+        return true;
+    case 14:
+        //Sync word is answered in hex
+        if (sscanf(ack, "%x", &a) != 1) return false;
+        snap.sync = a;
+        return true;
+    case 15:
+        return hexToBytes(ack, snap.devEui, sizeof(snap.devEui));
+    case 16:
+        return hexToBytes(ack, snap.appEui, sizeof(snap.appEui));
+    case 17:
+        return hexToBytes(ack, snap.appKey, sizeof(snap.appKey));
+    case 18:
+        if (strlen(ack) != 8 || sscanf(ack, "%x", &a) != 1) return false;
+        snap.devAddr = a;
+        return true;
+    case 19:
+        return hexToBytes(ack, snap.nwksKey, sizeof(snap.nwksKey));
+    case 20:
+        return hexToBytes(ack, snap.appsKey, sizeof(snap.appsKey));
+    case 21:
+    case 22: {
+        char *dst = field == 21 ? snap.version : snap.hwVersion;
+        if (strlen(ack) >= ACSIP_VERSION_SIZE) return false;
+        strcpy(dst, ack);
+        return true;
+    }
+    case 23:
+        //uuid=002400413630373619473630
+        ack = strchr(ack, '=');
+        return ack && hexToBytes(ack + 1, snap.uuid, sizeof(snap.uuid));
+    default:
+        return false;
+    }
+}
+
+struct SnapState {
+    AcsipSnapshot  *snap;
+    uint8_t         fields[sizeof(snapFields) / sizeof(snapFields[0])];
+    uint32_t        read;
+};
+
+static int snapSource(void *arg, uint16_t index, char *cmd, size_t size)
+{
+    SnapState *s = (SnapState *)arg;
+    strncpy(cmd, snapFields[s->fields[index]].cmd, size - 1);
+    cmd[size - 1] = '\0';
+    return S7XG_OK;
+}
+
+//A field that does not parse is left out, the others are still read.
+//Only the bytes of this field are kept to tell whether it changed
+static int snapSink(void *arg, uint16_t index, const char *ack)
+{
+    SnapState *s = (SnapState *)arg;
+    uint8_t field = s->fields[index];
+    uint32_t bit = 1UL << field;
+    uint8_t *bytes = (uint8_t *)s->snap + snapFields[field].offset;
+    uint8_t size = snapFields[field].size;
+    uint8_t old[ACSIP_VERSION_SIZE > 16 ? ACSIP_VERSION_SIZE : 16];
 
-        str = strrchr(rf_prt, 0x20);
-        if (str == NULL) {
-            goto exit;
+    if (size <= sizeof(old)) {
+        memcpy(old, bytes, size);
+    }
+    if (parseSnapField(field, ack, *s->snap)) {
+        s->read |= bit;
+        if (!(s->snap->valid & bit) || size > sizeof(old) || memcmp(old, bytes, size) != 0) {
+            s->snap->changed |= bit;
         }
-        offset = str - rf_prt;
-        rssi = atoi(str + 1 );
-        rf_prt[offset] = 0;
+    }
+    return S7XG_OK;
+}
+
+int Acsip::snapshot(AcsipSnapshot &snap, uint32_t mask)
+{
+    uint32_t start = millis();
+    SnapState s;
+    uint16_t count = 0;
 
-        size_t len;
-        hexToString(rf_prt, serial_buffer, strlen(rf_prt), len);
-        serial_buffer[len] = 0;
-        _rf_callback((char *)serial_buffer, rssi, snr);
+    mask &= ACSIP_SNAP_ALL;
+    snap.changed = 0;
+    s.snap = &snap;
+    s.read = 0;
+    for (uint8_t i = 0; i < sizeof(snapFields) / sizeof(snapFields[0]); i++) {
+        if ((mask & (1UL << i)) && (1UL << i) != ACSIP_SNAP_BATTERY) {
+            s.fields[count++] = i;
+        }
     }
 
-exit:
-    if (ptr) {
-        free(ptr);
+    int ret = batch(count, snapSource, snapSink, &s);
+
+    //Two reply frames, not for the queue
+    uint16_t volt;
+    if (ret == S7XG_OK && (mask & ACSIP_SNAP_BATTERY) && getBatteryVoltage(volt) == S7XG_OK) {
+        if (!(snap.valid & ACSIP_SNAP_BATTERY) || snap.battery != volt) {
+            snap.changed |= ACSIP_SNAP_BATTERY;
+        }
+        snap.battery = volt;
+        s.read |= ACSIP_SNAP_BATTERY;
+    }
+    snap.valid |= s.read;
+    snap.elapsed = millis() - start;
+
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    return s.read == mask ? S7XG_OK : S7XG_FAILED;
+}
+
+//Remove the requests of 'cb' (and 'arg' if given), their args go to 'args'
+int Acsip::dropRequests(acsip_callback cb, void *arg, void **args)
+{
+    int cancelled = 0;
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        AcsipRequest &req = _queue[(_head + i) % ACSIP_QUEUE_SIZE];
+        if (cb && req.cb == cb && (!arg || req.arg == arg)) {
+            args[cancelled++] = req.arg;
+            if (i != 0 || !_active) {
+                continue;
+            }
+            req.cb = nullptr;
+        }
+        if (kept != i) {
+            _queue[(_head + kept) % ACSIP_QUEUE_SIZE] = req;
+        }
+        kept++;
+    }
+    _count = kept;
+    return cancelled;
+}
+
+int Acsip::cancel(acsip_callback cb, void *arg)
+{
+    void *args[ACSIP_QUEUE_SIZE];
+    return dropRequests(cb, arg, args);
+}
+
+int Acsip::cancel(acsip_callback cb)
+{
+    void *args[ACSIP_QUEUE_SIZE];
+    int cancelled = dropRequests(cb, NULL, args);
+    //Called once the queue is consistent, a callback may submit again
+    for (int i = 0; i < cancelled; i++) {
+        cb(args[i], S7XG_FAILED, "");
+    }
+    return cancelled;
+}
+
+bool Acsip::pending()
+{
+    return _count != 0;
+}
+
+uint8_t Acsip::queued()
+{
+    return _count;
+}
+
+bool Acsip::readable()
+{
+    return _port->available() > 0;
+}
+
+void Acsip::startRequest()
+{
+    AcsipRequest &req = _queue[_head];
+    _port->print(req.cmd);
+    DEBUGLN(req.cmd);
+    _framesLeft = req.frames;
+    _started = millis();
+    _active = true;
+}
+
+void Acsip::finishRequest(int err, const char *ack)
+{
+    AcsipRequest &req = _queue[_head];
+    acsip_callback cb = req.cb;
+    void *arg = req.arg;
+    _head = (_head + 1) % ACSIP_QUEUE_SIZE;
+    _count--;
+    _active = false;
+    //The callback may submit the next command
+    if (cb) {
+        cb(arg, err, ack);
+    }
+}
+
+//Same framing as waitForAck, [\n\r>> ] <text> [\n]
+bool Acsip::feed(uint8_t c)
+{
+    static const uint8_t prefix[4] = {0xA, 0xD, 0x3E, 0x3E};
+    if (_rxLen < sizeof(prefix) && c != prefix[_rxLen]) {
+        _rxLen = 0;
+        if (c != prefix[0]) {
+            return false;
+        }
+    }
+    if (_rxLen >= sizeof(_rx) - 1) {
+        //Overflow, wait for the next prefix
+        _rxLen = 0;
+        return false;
+    }
+    _rx[_rxLen++] = c;
+    if (c == 0xA && _rxLen > 5) {
+        _rx[_rxLen - 1] = '\0';
+        return true;
+    }
+    return false;
+}
+
+void Acsip::dispatchFrame(char *frame)
+{
+    if (rf_check_available(frame)) {
+        if (_rf_callback) {
+            size_t len;
+            int rssi = 0, snr = 0;
+            if (parseRadioRx(frame, (uint8_t *)frame, strlen(frame), len, rssi, snr) == S7XG_OK) {
+                frame[len] = '\0';
+                _rf_callback(frame, rssi, snr);
+            }
+        }
+        return;
+    }
+    if (!_active) {
+        DEBUG("Unsolicited: ");
+        DEBUGLN(frame);
+        return;
+    }
+    if (--_framesLeft == 0 || strcmp(frame, "Ok") != 0) {
+        finishRequest(S7XG_OK, frame);
     }
-    return 0;
 }
 
+int Acsip::process(uint16_t budget)
+{
+    int events = 0;
+
+    if (_gpsInterval && !_gpsPolling && millis() - _gpsLastPoll >= _gpsInterval) {
+        static const char *gpsType[] = {
+            "gps get_data raw", "gps get_data dd", "gps get_data dms"
+        };
+        if (submit(gpsType[_gpsType], gpsPollDone, this) == S7XG_OK) {
+            _gpsPolling = true;
+            _gpsLastPoll = millis();
+        }
+    }
+
+    if (!_active && _count) {
+        startRequest();
+    }
+
+    while (budget-- && _port->available()) {
+        if (feed(_port->read())) {
+            bool wasActive = _active;
+            dispatchFrame(&_rx[5]);
+            _rxLen = 0;
+            events++;
+            if (wasActive && !_active && _count) {
+                startRequest();
+            }
+        }
+    }
+
+    if (_active) {
+        uint32_t timeout = _queue[_head].timeout ? _queue[_head].timeout : _timeout;
+        if (millis() - _started > timeout) {
+            _rxLen = 0;
+            finishRequest(S7XG_TIMEROUT, "");
+            events++;
+            if (_count) {
+                startRequest();
+            }
+        }
+    }
+    return events;
+}
@@ -19,6 +19,17 @@
 
 #define DEFAULT_SERIAL_TIMEOUT          10000
 
+// Reply timeout used while probing the module baud rate
+#define ACSIP_BAUD_PROBE_TIMEOUT        300
+
+// "sip set_baudrate" password, v1.6.5 and later. Older firmware uses "12345678"
+#define ACSIP_BAUD_PASSWORD             "24399520"
+
+// Bytes per write while streaming "sip set_storage"
+#ifndef ACSIP_STORAGE_CHUNK
+#define ACSIP_STORAGE_CHUNK             64
+#endif
+
 #ifndef INPUT
 #define INPUT             0x01
 #endif
@@ -30,12 +41,42 @@
 #define ACSIP_CHECK_ERROR(ret)                                          \
                 do{                                                     \
                     if(ret != S7XG_OK){                                 \
-                        Serial.printf("[%lu]:%s %d line failed,error code:%s\n",millis(),__FILE__, __LINE__,Acsip::errrToString(ret).c_str());         \
+                        Serial.printf("[%lu]:%s %d line failed,error code:%s\n",millis(),__FILE__, __LINE__,Acsip::errorToString(ret));         \
                         while (1);                                      \
                     }                                                   \
                 }while(0)
 
 
+// Command/reply buffer, the longest command or single line reply has to fit
+#ifndef ACSIP_BUFFER_SIZE
+#define ACSIP_BUFFER_SIZE               256
+#endif
+
+// Receive framer arena shared by the blocking calls, service() and process().
+// A "radio_rx" line carries 2 hex digits per payload byte plus RSSI/SNR
+#ifndef ACSIP_RX_SIZE
+#define ACSIP_RX_SIZE                   256
+#endif
+
+// Most frames gathered for one multi-line reply, see AcsipResponseSpec
+#define ACSIP_RESPONSE_FRAMES           4
+
+// Non-blocking command queue, see Acsip::submit
+#ifndef ACSIP_QUEUE_SIZE
+#define ACSIP_QUEUE_SIZE                4
+#endif
+
+#ifndef ACSIP_REQUEST_SIZE
+#define ACSIP_REQUEST_SIZE              128
+#endif
+
+// Sizes of the strings kept by the instance, terminator included
+#define ACSIP_VERSION_SIZE              24
+#define ACSIP_UUID_SIZE                 32
+#define ACSIP_KEY_SIZE                  33      // 128 bit key in hex
+#define ACSIP_EUI_SIZE                  17      // 64 bit EUI in hex
+#define ACSIP_DEVADDR_SIZE              9       // 32 bit address in hex
+
 #define STRNCMP_FULLSTRING(str)   (strncmp(ptr, str, strlen(str)) == 0)
 
 
@@ -54,9 +95,19 @@ enum S7XG_Error {
     S7XG_GPS_SUCCESS,
     S7XG_GPS_ERROR,
     S7XG_COMMAND_ERROR,
+    S7XG_QUEUE_FULL,            // host side command queue, the module was not asked
     S7XG_UNKONW,
 };
 
+// Indexed by 'S7XG_Error'
+constexpr const char *const acsipErrorStrings[] = {
+    "OK", "Failed", "Timeout", "Joined", "UnJoined", "Command invald",
+    "Already Joined", "Busy", "Invald len", "Not init", "Positioning",
+    "Success", "GPS Connect Error", "Unknown command!", "Queue full", "Unkonw",
+};
+static_assert(sizeof(acsipErrorStrings) / sizeof(acsipErrorStrings[0]) == S7XG_UNKONW + 1,
+              "acsipErrorStrings must cover every S7XG_Error");
+
 enum GPIOGroup {
     S7XG_GPIO_GROUP_A,
     S7XG_GPIO_GROUP_B,
@@ -140,6 +191,16 @@ enum MacJoin {
 enum AcsipFwVer {
     ACSIP_FW_VERSION_V165G9,
     ACSIP_FW_VERSION_V166G11,
+    ACSIP_FW_VERSION_UNKNOWN,
+};
+
+// Firmware dependent commands, see Acsip::hasCapability
+enum AcsipCapability {
+    ACSIP_CAP_GPS_RESET         = 0x01,     // "gps reset"
+    ACSIP_CAP_GPS_LOW_POWER     = 0x02,     // "gps set_low_power"
+    ACSIP_CAP_SLEEP_GPS_LEVEL   = 0x04,     // "sip sleep" takes gps_sleep_0/1/2
+    ACSIP_CAP_SET_KEYS          = 0x08,     // all keys in one "mac set_keys"
+    ACSIP_CAP_SATELLITE_HYBRID  = 0x10,     // GPS+GLONASS is "hybrid", not "gps_glonass"
 };
 
 struct GPSModeStruct {
@@ -195,6 +256,8 @@ struct GPSDataStruct {
     };
     bool isValid;
     float second;
+    GPSDataType type;       // which union member holds the fix
+    uint32_t timestamp;     // millis() when the fix was taken
 };
 
 struct ChannelParameter {
@@ -205,15 +268,162 @@ struct ChannelParameter {
     uint8_t bandId;
 };
 
+// Fields of Acsip::snapshot, bit n is entry n of the command table
+enum AcsipSnapshotField {
+    ACSIP_SNAP_BAND             = 1UL << 0,
+    ACSIP_SNAP_ADR              = 1UL << 1,
+    ACSIP_SNAP_DATA_RATE        = 1UL << 2,
+    ACSIP_SNAP_POWER            = 1UL << 3,
+    ACSIP_SNAP_RX2              = 1UL << 4,
+    ACSIP_SNAP_RX_DELAY         = 1UL << 5,
+    ACSIP_SNAP_TX_RETRY         = 1UL << 6,
+    ACSIP_SNAP_UPLINK_COUNTER   = 1UL << 7,
+    ACSIP_SNAP_DOWNLINK_COUNTER = 1UL << 8,
+    ACSIP_SNAP_CHANNEL_COUNT    = 1UL << 9,
+    ACSIP_SNAP_CLASS            = 1UL << 10,
+    ACSIP_SNAP_JOINED           = 1UL << 11,
+    ACSIP_SNAP_DUTY_CYCLE       = 1UL << 12,
+    ACSIP_SNAP_TX_CONFIRM       = 1UL << 13,
+    ACSIP_SNAP_SYNC             = 1UL << 14,
+    ACSIP_SNAP_DEV_EUI          = 1UL << 15,
+    ACSIP_SNAP_APP_EUI          = 1UL << 16,
+    ACSIP_SNAP_APP_KEY          = 1UL << 17,
+    ACSIP_SNAP_DEV_ADDR         = 1UL << 18,
+    ACSIP_SNAP_NWKS_KEY         = 1UL << 19,
+    ACSIP_SNAP_APPS_KEY         = 1UL << 20,
+    ACSIP_SNAP_VERSION          = 1UL << 21,
+    ACSIP_SNAP_HW_VERSION       = 1UL << 22,
+    ACSIP_SNAP_UUID             = 1UL << 23,
+    ACSIP_SNAP_BATTERY          = 1UL << 24,
+    ACSIP_SNAP_ALL              = (1UL << 25) - 1,
+};
+
+// Keys, EUIs and the UUID are kept as bytes, not hex strings
+struct __attribute__((packed)) AcsipSnapshot {
+    uint32_t    valid;              // fields read at least once
+    uint32_t    changed;            // fields of the last snapshot that differ from before
+    uint32_t    elapsed;            // ms taken by the last snapshot
+    uint16_t    band;
+    bool        adr;
+    uint8_t     dataRate;
+    int8_t      power;              // dBm
+    uint8_t     rx2DataRate;
+    uint32_t    rx2Freq;
+    uint32_t    rx1Delay;           // ms
+    uint32_t    rx2Delay;
+    uint8_t     txRetry;
+    uint32_t    uplinkCounter;
+    uint32_t    downlinkCounter;
+    uint8_t     channelCount;
+    char        devClass;           // 'A' or 'C'
+    bool        joined;
+    bool        dutyCycle;
+    bool        txConfirm;
+    uint8_t     sync;
+    uint8_t     devEui[8];
+    uint8_t     appEui[8];
+    uint8_t     appKey[16];
+    uint32_t    devAddr;
+    uint8_t     nwksKey[16];
+    uint8_t     appsKey[16];
+    char        version[ACSIP_VERSION_SIZE];
+    char        hwVersion[ACSIP_VERSION_SIZE];
+    uint8_t     uuid[12];
+    uint16_t    battery;            // mV
+};
+
 typedef void (*rf_callback)(const char *data, int rssi, int snr);
 
+// Module states reported to the state callback, see AcsipEnergy
+enum AcsipState {
+    ACSIP_STATE_IDLE,               // awake, UART listening
+    ACSIP_STATE_SLEEP,              // "sip sleep", value: seconds
+    ACSIP_STATE_TX,                 // P2P transmission, value: payload bytes
+    ACSIP_STATE_RX,                 // receive window
+    ACSIP_STATE_RX_CONTINUOUS,      // "rf rx_con on"
+    ACSIP_STATE_GPS_OFF,
+    ACSIP_STATE_GPS_ACTIVE,
+    ACSIP_STATE_GPS_SLEEP,
+    ACSIP_STATE_GPS_DEEP_SLEEP,
+    ACSIP_STATE_MAX,
+    // Transition only: LoRaWAN uplink, TX then the RX1/RX2 windows, value: PHY payload bytes
+    ACSIP_STATE_UPLINK = ACSIP_STATE_MAX,
+};
+
+typedef void (*acsip_state_callback)(void *arg, AcsipState state, uint32_t value);
+
+// Completion of a queued command, ack is the last reply frame
+typedef void (*acsip_callback)(void *arg, int err, const char *ack);
+
+// Pipelined batch, see Acsip::batch. Both return a 'S7XG_Error' code
+typedef int (*acsip_batch_source)(void *arg, uint16_t index, char *cmd, size_t size);
+typedef int (*acsip_batch_sink)(void *arg, uint16_t index, const char *ack);
+
+// Reply frame starting with 'prefix', followed by a space, '(' or the end
+struct AcsipToken {
+    const char *prefix;
+    int         err;                // result when this frame ends the reply
+};
+
+// Shape of a multi-line reply, token lists end with a NULL prefix
+struct AcsipResponseSpec {
+    uint8_t             frames;         // most frames, at most ACSIP_RESPONSE_FRAMES
+    const AcsipToken   *terminal;       // the reply ends with one of these
+    const char *const  *intermediate;   // more frames follow these
+    int                 unexpected;     // result for any other frame
+};
+
+// Frames of one reply, they point into the instance command buffer
+struct AcsipResponse {
+    uint8_t     count;
+    const char *frame[ACSIP_RESPONSE_FRAMES];
+
+    const char *last() const
+    {
+        return count ? frame[count - 1] : "";
+    }
+};
+
+struct AcsipRequest {
+    char            cmd[ACSIP_REQUEST_SIZE];
+    uint8_t         frames;
+    uint32_t        timeout;
+    acsip_callback  cb;
+    void           *arg;
+};
+
 class Acsip
 {
 public:
     static String errrToString(int err_code);
 
+    // Same text as errrToString, without a heap allocation
+    static constexpr const char *errorToString(int err_code)
+    {
+        return (err_code >= S7XG_OK && err_code <= S7XG_UNKONW) ? acsipErrorStrings[err_code] : "Unkonw";
+    }
+
+    // Map a single-reply command answer to 'S7XG_Error'
+    static int ackToError(const char *ack);
+
+    // Map the final "mac join" answer to 'S7XG_Error', same table as join()
+    static int joinToError(const char *ack);
 
-    bool begin(HardwareSerial &port);
+    // CRC-32 (IEEE 802.3), pass the previous result to continue a running CRC
+    static uint32_t crc32(const void *data, size_t len, uint32_t crc = 0);
+
+
+    /**
+     * @brief  begin
+     * @note   The module baud rate is detected automatically, the host port
+     *         is switched to it. If maxBaud is given, the link is raised to the
+     *         fastest rate supported by both sides that does not exceed it.
+     * @param  port: UART connected to the module, must already be started
+     * @param  maxBaud: highest rate the host accepts, 0 keeps the detected rate
+     * @param  password: "sip set_baudrate" password
+     * @retval true if a S76G/S78G module is found
+     */
+    bool begin(HardwareSerial &port, uint32_t maxBaud = 0, const char *password = ACSIP_BAUD_PASSWORD);
 
     /*****************************************
      *          SIP FUNCTION
@@ -222,6 +432,7 @@ public:
     void reset();
     const char *getModel();
     const char *factoryReset();
+    //The returned strings stay valid until the same getter is called again
     const char *getVersion();
 
     int setEcho(bool on);
@@ -230,11 +441,79 @@ public:
     const char *getHardWareVer();
     const char *getUUID();
 
+    //Copy into a caller buffer, S7XG_INVALD_LEN if it is too small
+    int getVersion(char *ver, size_t size);
+    int getHardWareVer(char *ver, size_t size);
+    int getUUID(char *uuid, size_t size);
+
     int sleep(uint32_t second, bool uratWake);
+    // gpsLevel: 0 ~ 2, deeper levels draw less but restart slower. G11 only
+    int sleep(uint32_t second, bool uratWake, uint8_t gpsLevel);
+
+    /**
+     * @brief  wakeup
+     * @note   Ends a "sip sleep ... uart_on" early, any UART input wakes the
+     *         module and it answers "Ok". After a timed wake the pending "Ok"
+     *         is consumed instead, so it is not taken for the next reply.
+     * @retval S7XG_OK once the module answers, S7XG_TIMEROUT otherwise
+     */
+    int wakeup(uint32_t timeout = ACSIP_BAUD_PROBE_TIMEOUT);
+
+    // ACSIP_FW_VERSION_xxx detected by begin
+    int getFirmwareVersion();
+
+    /**
+     * @brief  hasCapability
+     * @note   Commands the detected firmware lacks are rejected locally with
+     *         S7XG_COMMAND_ERROR instead of waiting for "Unknown command!".
+     *         With an unknown firmware every command is tried.
+     * @param  cap: 'AcsipCapability' flags
+     */
+    bool hasCapability(uint32_t cap);
 
     int setBaudRate(uint32_t baud, const char *password);
-    int setStorage(uint8_t *buffer, uint32_t len);
-    int getStorage(uint8_t *buffer, uint32_t &len);
+    int autoBaud(uint32_t &baud);
+
+    /**
+     * @brief  ping
+     * @note   Drains the port and sends a harmless query. Tells a silent
+     *         module from one that answers with bytes the framer can not sync
+     *         to, which usually means a baud rate mismatch.
+     * @retval S7XG_OK on a valid reply frame, S7XG_FAILED if only garbage
+     *         arrived, S7XG_TIMEROUT if nothing arrived
+     */
+    int ping(uint32_t timeout = ACSIP_BAUD_PROBE_TIMEOUT);
+    int negotiateBaud(uint32_t maxBaud, const char *password = ACSIP_BAUD_PASSWORD);
+    uint32_t getBaudRate();
+
+    /**
+     * @brief  setStorage
+     * @note   Overwrite the whole module EEPROM with an encrypted image read by
+     *         getStorage, from a module with the same hardware and firmware.
+     *         The image is streamed in ACSIP_STORAGE_CHUNK byte writes and read
+     *         back to compare length and CRC.
+     * @param  buffer: ASCII image
+     * @param  len: image length
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int setStorage(const uint8_t *buffer, uint32_t len);
+
+    /**
+     * @brief  getStorage
+     * @note   The reply is streamed straight into 'buffer', only the bytes in
+     *         [offset, offset + len) are kept.
+     * @param  buffer: destination
+     * @param  len: buffer size on input, bytes copied on output
+     * @param  offset: first byte of the image to copy
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int getStorage(uint8_t *buffer, uint32_t &len, uint32_t offset = 0);
+
+    // Length of the encrypted EEPROM image
+    int getStorageSize(uint32_t &size);
+
+    // Compare the module EEPROM image with 'buffer' by length and CRC
+    int verifyStorage(const uint8_t *buffer, uint32_t len);
 
     int setGPIOMode(GPIOGroup group, int pin, int mode);
     int setGPIOValue(GPIOGroup group, int pin, uint8_t val);
@@ -292,11 +571,23 @@ public:
     int getDevEui(String &eui);
     int getDevAddr(String &addr);
 
+    //See ACSIP_KEY_SIZE, ACSIP_EUI_SIZE and ACSIP_DEVADDR_SIZE for the buffer sizes
+    int getAppKey(char *key, size_t size);
+    int getAppSessionKey(char *key, size_t size);
+    int getNetworkSessionKey(char *key, size_t size);
+    int getAppEui(char *eui, size_t size);
+    int getDevEui(char *eui, size_t size);
+    int getDevAddr(char *addr, size_t size);
+
 
 
     int getJoinChannel();
     int getUplinkCounter(uint32_t &count);
     int getDownLinkCounter(uint32_t &count);
+    int setUplinkCounter(uint32_t count);
+    int setDownLinkCounter(uint32_t count);
+    //Save LoRaWAN configuration parameters to flash.
+    int setMacSave();
     int setTxMode(TxMode mode);
     int getTxMode(TxMode &mode);
     int setBatteryIndication(uint8_t level);
@@ -314,6 +605,10 @@ public:
     int getMaxEIRP(uint8_t &index);
     int setChannelCount(uint8_t channelCount, uint16_t bw);
     int getChannelCount(uint8_t &count);
+    // Single setters, "mac set_keys" needs all six keys (ACSIP_CAP_SET_KEYS)
+    int setOTAAKeys(const char *devEui, const char *appEui, const char *appKey);
+    int setABPKeys(const char *devAddr, const char *appsKey, const char *nwksKey);
+    // Writes all six keys to EEPROM at once, each in the single setter format
     int setKeys(const char *devAddr, const char *devEui, const char *appEui, const char *appKey, const char *appsKey,
                 const char *nwksKey);
     int setTxInterval(uint32_t ms);
@@ -363,6 +658,13 @@ public:
 
     int RfSend(char *hexData);
 
+    //Send raw bytes, the hex string is streamed to the port, maximum 255 bytes.
+    int RfSend(const uint8_t *data, size_t len);
+
+    //Open a single receive window of 1 to 65535 ms with "rf rx".
+    //Continuous reception must be off.
+    int RfReceive(uint8_t *data, size_t &len, int &rssi, int &snr, uint16_t window);
+
     int RfSendString(const char *str);
 
     int getRfFreq(uint32_t &freq);
@@ -386,10 +688,16 @@ public:
     int setStart(GPSStartMode type);
 
     int getMode(GPSModeStruct &data);
+
+    // Command arguments of the GPS setters, NULL when out of range
+    static const char *gpsModeName(GPSMode mode);
+    static const char *gpsStartName(GPSStartMode type);
+    const char *satelliteName(GPSSatelliteSys type);
     int getData( GPSDataStruct &data, GPSDataType type = S7XG_GPS_DATA_DD);
     int getTtff(float &second);
 
     int gpsReset();
+    int setGPSLowPower(bool on);
     int gpsSleep();
     int gpsDeepSleep();
     int gpsWakeup();
@@ -401,7 +709,28 @@ public:
     int GPSStop();
 
 
-    struct GPSDataStruct GPSData;
+    // Latest valid fix, updated by getData, the background poll and updateGPS
+    struct GPSDataStruct GPSData = {};
+
+    /**
+     * @brief  setGPSPollInterval
+     * @note   Poll "gps get_data" from process() every 'ms' and keep the
+     *         latest valid fix in GPSData. The GPS must run in manual mode.
+     *         Blocking calls made while a poll is on the wire first run
+     *         process() until it has answered, so both can be mixed.
+     * @param  ms: poll period, 0 stops polling
+     * @param  type: data format stored in GPSData
+     */
+    void setGPSPollInterval(uint32_t ms, GPSDataType type = S7XG_GPS_DATA_DD);
+
+    // Store a fix from another source (NMEA stream, decoded uplink ...)
+    void updateGPS(const GPSDataStruct &data);
+
+    // ms since the cached fix was taken, UINT32_MAX when there is none
+    uint32_t getFixAge();
+
+    // Decimal degrees of a fix, whatever GPSDataType it was read with
+    static void toDegrees(const GPSDataStruct &data, double &lat, double &lng);
 
     /*****************************************
      *          OTHER FUNCTION
@@ -410,26 +739,144 @@ public:
     int  service();
     void setRFCallback(rf_callback cb);
 
+    // Called on module state changes made by the blocking calls
+    void setStateCallback(acsip_state_callback cb, void *arg = nullptr);
+
+    /**
+     * @brief  snapshot
+     * @note   The getters of the mask are issued as one pipelined batch (see
+     *         batch), the battery voltage is read last as it answers with two
+     *         frames. Fields outside the mask keep their previous value.
+     * @param  snap: zeroed before the first call, 'changed' and 'elapsed'
+     *         describe this call
+     * @param  mask: 'AcsipSnapshotField' bits
+     * @retval S7XG_OK, S7XG_FAILED if a field could not be read, it is left
+     *         out of 'valid'. A timeout ends the snapshot early.
+     */
+    int  snapshot(AcsipSnapshot &snap, uint32_t mask = ACSIP_SNAP_ALL);
+
+    /*****************************************
+     *          ASYNC FUNCTION
+     ****************************************/
+    /**
+     * @brief  submit
+     * @note   Queue a command without blocking. It is written to the port by
+     *         process() once the previous command has completed.
+     * @param  cmd: command line
+     * @param  cb: completion callback, may be nullptr
+     * @param  arg: passed back to cb
+     * @param  frames: reply frames, 2 for commands that answer "Ok" first
+     *                 and a result later (mac join, mac tx, rf tx)
+     * @param  timeout: ms for the whole exchange, 0 uses setTimeout value
+     * @retval S7XG_OK, S7XG_QUEUE_FULL if the queue is full
+     */
+    int submit(const char *cmd, acsip_callback cb, void *arg, uint8_t frames = 1, uint32_t timeout = 0);
+
+    /**
+     * @brief  process
+     * @note   Drive the queue and the receive framer, never blocks.
+     *         Unsolicited radio_rx frames go to the RF callback.
+     * @param  budget: maximum bytes read from the port in this call
+     * @retval number of completed commands and dispatched frames
+     */
+    int process(uint16_t budget = 0xFFFF);
+
+    /**
+     * @brief  batch
+     * @note   Run 'count' single reply commands through the queue, blocking
+     *         until all are answered. The queue is kept full, so each
+     *         command is written as soon as the previous reply has arrived.
+     *         The first error stops new commands from being queued.
+     * @param  count: commands in the batch
+     * @param  source: writes command 'index' into 'cmd'
+     * @param  sink: checks the reply of command 'index', nullptr uses ackToError
+     * @param  arg: passed back to source and sink
+     * @retval first error of the batch, S7XG_OK if none
+     */
+    int batch(uint16_t count, acsip_batch_source source, acsip_batch_sink sink, void *arg);
+
+    /**
+     * @brief  cancel
+     * @note   Complete every queued command using 'cb' with S7XG_FAILED.
+     *         Commands not written yet are dropped, the one on the wire stays
+     *         queued without a callback so its reply is still consumed.
+     * @param  cb: completion callback given to submit
+     * @retval number of cancelled commands
+     */
+    int cancel(acsip_callback cb);
+
+    /**
+     * @brief  cancel
+     * @note   Drop the commands submitted with 'cb' and 'arg' without calling
+     *         back, for an owner that goes away before its reply arrives.
+     * @retval number of dropped commands
+     */
+    int cancel(acsip_callback cb, void *arg);
+
+    bool pending();
+    uint8_t queued();
+    bool readable();
+
 private:
 
     bool rf_check_available(const char *ptr);
     int getArgs(const char *cmd, const char *format, ...);
     template <typename T> int getUnit(const char *cmd, T &value);
     int checkOnOff(const char *cmd, bool &isOn);
+    int getString(const char *cmd, char *dst, size_t size);
     int universalSendConnamd(const char *format, ...);
     int snedConnamd(const char *format, ...);
     int universalSendCmd(const char *cmd);
+    bool probe();
+    void setPortBaudRate(uint32_t baud);
     inline bool cmpstr(const char *str) __attribute__((always_inline));
     inline void sendCmd(const char *cmd) __attribute__((always_inline));
+    void waitIdle();
+    inline void notify(AcsipState state, uint32_t value = 0) __attribute__((always_inline));
+    void notifySleep(uint32_t second, uint8_t gpsLevel);
 
     int waitForAck(char *ack, uint32_t timeout = 0);
-
-    char            buffer[256];
+    int collect(const AcsipResponseSpec &spec, AcsipResponse &rsp, uint32_t timeout = 0);
+    int readStorage(uint8_t *data, uint32_t offset, uint32_t &len, uint32_t &size, uint32_t &crc);
+    bool feed(uint8_t c);
+    void dispatchFrame(char *frame);
+    void startRequest();
+    int parseGPSData(const char *ack, GPSDataStruct &data, GPSDataType type);
+    static void gpsPollDone(void *arg, int err, const char *ack);
+    void finishRequest(int err, const char *ack);
+    int dropRequests(acsip_callback cb, void *arg, void **args);
+
+    char            buffer[ACSIP_BUFFER_SIZE];
     HardwareSerial *_port;
     bool            isHardwareSerial = false;
 
     uint32_t        _timeout;
+    uint32_t        _baud = 0;
     rf_callback     _rf_callback = nullptr;
-    int          version;
+    acsip_state_callback _state_callback = nullptr;
+    void           *_state_arg = nullptr;
+    AcsipState      _gpsState = ACSIP_STATE_GPS_OFF;
+    AcsipState      _gpsResume = ACSIP_STATE_GPS_OFF;
+    int          version = ACSIP_FW_VERSION_UNKNOWN;
+    uint32_t        _caps;
+    char            _version[ACSIP_VERSION_SIZE];
+    char            _hwVersion[ACSIP_VERSION_SIZE];
+    char            _uuid[ACSIP_UUID_SIZE];
+
+    //Non-blocking engine state
+    char            _rx[ACSIP_RX_SIZE];
+    uint16_t        _rxLen = 0;
+    AcsipRequest    _queue[ACSIP_QUEUE_SIZE];
+    uint8_t         _head = 0;
+    uint8_t         _count = 0;
+    bool            _active = false;
+    uint8_t         _framesLeft = 0;
+    uint32_t        _started = 0;
+
+    //Background GPS poll
+    uint32_t        _gpsInterval = 0;
+    uint32_t        _gpsLastPoll = 0;
+    GPSDataType     _gpsType = S7XG_GPS_DATA_DD;
+    bool            _gpsPolling = false;
 
 };
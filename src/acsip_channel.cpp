@@ -0,0 +1,193 @@
+#include "acsip_channel.h"
+
+//Same channels as the TTN frequency plans
+static const uint8_t eu868Ids[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+static const uint32_t eu868Freq[] = {
+    868100000, 868300000, 868500000, 867100000, 867300000,
+    867500000, 867700000, 867900000, 868800000,
+};
+
+//Sub-band 2, 125kHz channels 8 - 15 and the 500kHz channel 65
+static const uint8_t us915Ids[] = {8, 9, 10, 11, 12, 13, 14, 15, 65};
+
+static const uint8_t as923Ids[] = {0, 1, 2, 3, 4, 5, 6, 7};
+static const uint32_t as923Freq[] = {
+    923200000, 923400000, 922200000, 922400000,
+    922600000, 922800000, 923000000, 922000000,
+};
+
+//486.3 - 487.7MHz, the band default frequencies of channels 80 - 87
+static const uint8_t cn470Ids[] = {80, 81, 82, 83, 84, 85, 86, 87};
+
+const AcsipChannelPlan acsipChannelPlans[] = {
+    {"EU868", 868, 16, {0, 0}, sizeof(eu868Ids), eu868Ids, eu868Freq, 0, 869525000},
+    {"US915", 915, 72, {125, 500}, sizeof(us915Ids), us915Ids, NULL, 8, 923300000},
+    {"AS923", 923, 16, {0, 0}, sizeof(as923Ids), as923Ids, as923Freq, 2, 923200000},
+    {"CN470", 470, 96, {125, 0}, sizeof(cn470Ids), cn470Ids, NULL, 0, 505300000},
+};
+
+const size_t acsipChannelPlanCount = sizeof(acsipChannelPlans) / sizeof(acsipChannelPlans[0]);
+
+const AcsipChannelPlan *acsipChannelPlanFind(const char *region)
+{
+    for (size_t i = 0; i < acsipChannelPlanCount; i++) {
+        if (strcmp(acsipChannelPlans[i].region, region) == 0) {
+            return &acsipChannelPlans[i];
+        }
+    }
+    return NULL;
+}
+
+const AcsipChannelPlan *acsipChannelPlanForBand(int band)
+{
+    for (size_t i = 0; i < acsipChannelPlanCount; i++) {
+        if (acsipChannelPlans[i].band == band) {
+            return &acsipChannelPlans[i];
+        }
+    }
+    return NULL;
+}
+
+void acsipChannelPlanMap(const AcsipChannelPlan &plan, AcsipChannelMap &map)
+{
+    map.clear();
+    for (uint8_t i = 0; i < plan.count; i++) {
+        map.set(plan.ids[i]);
+    }
+}
+
+/*****************************************
+ *          APPLY
+ ****************************************/
+struct ApplyState {
+    const AcsipChannelPlan *plan;
+    AcsipChannelMap         enabled;
+    uint8_t                 groups;     // "mac set_ch_count 0 <bw>" commands
+    uint8_t                 freqs;      // "mac set_ch_freq" commands
+    uint8_t                 states;     // "mac set_ch_status" commands
+};
+
+//Command order: group clears, frequencies, channel states, RX2
+static int applySource(void *arg, uint16_t index, char *cmd, size_t size)
+{
+    ApplyState *s = (ApplyState *)arg;
+    const AcsipChannelPlan &plan = *s->plan;
+
+    if (index < s->groups) {
+        snprintf(cmd, size, "mac set_ch_count 0 %u", plan.clearBw[index]);
+        return S7XG_OK;
+    }
+    index -= s->groups;
+    if (index < s->freqs) {
+        snprintf(cmd, size, "mac set_ch_freq %u %u", plan.ids[index], plan.freq[index]);
+        return S7XG_OK;
+    }
+    index -= s->freqs;
+    if (index < s->states) {
+        //Without group clears every channel state is written, else only the enabled ones
+        uint8_t ch = s->groups ? plan.ids[index] : index;
+        snprintf(cmd, size, "mac set_ch_status %u %s", ch, s->enabled.isSet(ch) ? "on" : "off");
+        return S7XG_OK;
+    }
+    snprintf(cmd, size, "mac set_rx2 %u %u", plan.rx2DataRate, plan.rx2Freq);
+    return S7XG_OK;
+}
+
+int acsipChannelPlanApply(Acsip &acsip, const AcsipChannelPlan &plan)
+{
+    ApplyState s;
+    s.plan = &plan;
+    acsipChannelPlanMap(plan, s.enabled);
+    s.groups = (plan.clearBw[0] != 0) + (plan.clearBw[1] != 0);
+    s.freqs = plan.freq ? plan.count : 0;
+    s.states = s.groups ? plan.count : plan.channels;
+    return acsip.batch(s.groups + s.freqs + s.states + 1, applySource, NULL, &s);
+}
+
+/*****************************************
+ *          SWEEP
+ ****************************************/
+struct SweepState {
+    uint8_t          channels;
+    AcsipChannelMap *map;
+    uint32_t        *freq;
+};
+
+static int sweepSource(void *arg, uint16_t index, char *cmd, size_t size)
+{
+    SweepState *s = (SweepState *)arg;
+    if (index < s->channels) {
+        snprintf(cmd, size, "mac get_ch_status %u", index);
+    } else {
+        snprintf(cmd, size, "mac get_ch_para %u", index - s->channels);
+    }
+    return S7XG_OK;
+}
+
+static int sweepSink(void *arg, uint16_t index, const char *ack)
+{
+    SweepState *s = (SweepState *)arg;
+    if (index < s->channels) {
+        if (strcmp(ack, "on") == 0) {
+            s->map->set(index);
+            return S7XG_OK;
+        }
+        return strcmp(ack, "off") == 0 ? S7XG_OK : Acsip::ackToError(ack);
+    }
+    //<uplink frequency> <minimum DR> <maximum DR> <bandID> <downlink frequency>
+    unsigned long freq;
+    if (sscanf(ack, "%lu", &freq) != 1) {
+        return Acsip::ackToError(ack);
+    }
+    s->freq[index - s->channels] = freq;
+    return S7XG_OK;
+}
+
+int acsipChannelSweep(Acsip &acsip, uint8_t channels, AcsipChannelMap &map, uint32_t *freq)
+{
+    if (channels > ACSIP_CHANNEL_MAX) {
+        return S7XG_INVALD;
+    }
+    SweepState s = {channels, &map, freq};
+    map.clear();
+    return acsip.batch(freq ? 2 * channels : channels, sweepSource, sweepSink, &s);
+}
+
+//Only the channels the plan sets a frequency for are read, each compared as it arrives
+static int verifySource(void *arg, uint16_t index, char *cmd, size_t size)
+{
+    const AcsipChannelPlan *plan = (const AcsipChannelPlan *)arg;
+    snprintf(cmd, size, "mac get_ch_para %u", plan->ids[index]);
+    return S7XG_OK;
+}
+
+static int verifySink(void *arg, uint16_t index, const char *ack)
+{
+    const AcsipChannelPlan *plan = (const AcsipChannelPlan *)arg;
+    unsigned long freq;
+    if (sscanf(ack, "%lu", &freq) != 1) {
+        return Acsip::ackToError(ack);
+    }
+    return freq == plan->freq[index] ? S7XG_OK : S7XG_FAILED;
+}
+
+int acsipChannelPlanVerify(Acsip &acsip, const AcsipChannelPlan &plan, AcsipChannelMap *map)
+{
+    AcsipChannelMap found, expected;
+
+    int ret = acsipChannelSweep(acsip, plan.channels, found);
+    if (map) {
+        *map = found;
+    }
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    acsipChannelPlanMap(plan, expected);
+    if (!(found == expected)) {
+        return S7XG_FAILED;
+    }
+    if (!plan.freq) {
+        return S7XG_OK;
+    }
+    return acsip.batch(plan.count, verifySource, verifySink, (void *)&plan);
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Channel plans for the regions of the bundled firmware images.
+ *
+ * A plan is applied as one pipelined batch (see Acsip::batch): channel
+ * groups are switched off in bulk with "mac set_ch_count 0 <bw>" where the
+ * band has them, then the plan frequencies, every channel state and the
+ * RX2 window are written back-to-back. The result is read back in a single
+ * "mac get_ch_status" / "mac get_ch_para" sweep into a channel bitmap.
+ */
+
+// Largest band, CN470
+#define ACSIP_CHANNEL_MAX               96
+
+struct AcsipChannelMap {
+    uint32_t bits[(ACSIP_CHANNEL_MAX + 31) / 32];
+
+    void clear()
+    {
+        memset(bits, 0, sizeof(bits));
+    }
+    void set(uint8_t ch)
+    {
+        bits[ch >> 5] |= 1UL << (ch & 31);
+    }
+    bool isSet(uint8_t ch) const
+    {
+        return bits[ch >> 5] & (1UL << (ch & 31));
+    }
+    bool operator==(const AcsipChannelMap &other) const
+    {
+        return memcmp(bits, other.bits, sizeof(bits)) == 0;
+    }
+};
+
+struct AcsipChannelPlan {
+    const char     *region;         // "EU868", same names as the firmware images
+    int             band;           // "mac get_band" answer
+    uint8_t         channels;       // channel ids on the band
+    uint16_t        clearBw[2];     // groups switched off first with "mac set_ch_count 0 <bw>", 0 unused
+    uint8_t         count;          // enabled channels
+    const uint8_t  *ids;
+    const uint32_t *freq;           // uplink Hz per enabled channel, NULL keeps the band defaults
+    uint8_t         rx2DataRate;
+    uint32_t        rx2Freq;
+};
+
+extern const AcsipChannelPlan acsipChannelPlans[];
+extern const size_t acsipChannelPlanCount;
+
+// Plan by region name ("US915") or by "mac get_band" answer (915), NULL if unknown
+const AcsipChannelPlan *acsipChannelPlanFind(const char *region);
+const AcsipChannelPlan *acsipChannelPlanForBand(int band);
+
+// Channels the plan enables
+void acsipChannelPlanMap(const AcsipChannelPlan &plan, AcsipChannelMap &map);
+
+/**
+ * @brief  acsipChannelPlanApply
+ * @note   Blocks until every command has been answered. The first error
+ *         stops the batch, the commands already sent stay applied.
+ * @retval status code , see 'S7XG_Error' enum
+ */
+int acsipChannelPlanApply(Acsip &acsip, const AcsipChannelPlan &plan);
+
+/**
+ * @brief  acsipChannelSweep
+ * @note   One pipelined batch of "mac get_ch_status" for every channel,
+ *         and "mac get_ch_para" as well when 'freq' is given.
+ * @param  channels: channel ids to read, at most ACSIP_CHANNEL_MAX
+ * @param  map: enabled channels
+ * @param  freq: uplink Hz per channel, 'channels' entries, may be NULL
+ * @retval status code , see 'S7XG_Error' enum
+ */
+int acsipChannelSweep(Acsip &acsip, uint8_t channels, AcsipChannelMap &map, uint32_t *freq = NULL);
+
+/**
+ * @brief  acsipChannelPlanVerify
+ * @param  map: if not NULL, the channels found enabled
+ * @retval S7XG_OK if the enabled channels and frequencies match the plan,
+ *         S7XG_FAILED if they differ, other codes if the sweep failed
+ */
+int acsipChannelPlanVerify(Acsip &acsip, const AcsipChannelPlan &plan, AcsipChannelMap *map = NULL);
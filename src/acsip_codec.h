@@ -0,0 +1,272 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Schema driven bit-packed payload codec.
+ *
+ * A field is an integer range with a resolution, AcsipField<-400, 850, 10>
+ * holds -40.0 to 85.0 in 0.1 steps and takes the 11 bits its 1251 values
+ * need. A schema lists the fields, their bit offsets and the frame size
+ * are worked out at compile time, so encoding is a fixed sequence of
+ * shifts with nothing looked up at runtime:
+ *
+ *      typedef AcsipSchema<AcsipField<-400, 850, 10>,      // temperature C
+ *                          AcsipField<3000, 11000, 10>,    // pressure hPa
+ *                          AcsipField<0, 100> > Uplink;    // battery %
+ *
+ *      uint8_t frame[Uplink::size];
+ *      Uplink::encode(frame, 21.5, 1013.2, 87);
+ *      s76g.send(port, frame, Uplink::size);
+ *
+ * 4 bytes, the same readings take 12 as Cayenne LPP. Values outside a range
+ * are clamped.
+ * Fields are packed MSB first, field 0 starts at the top bit of byte 0.
+ *
+ * Only the C library is used, the same schema decodes on a Linux server,
+ * see extras/codec_decode. Round trips are checked by static_assert below,
+ * the byte level ones need C++14 constexpr.
+ */
+
+#if __cplusplus >= 201402L
+#define ACSIP_CODEC_CONSTEXPR   constexpr
+#else
+#define ACSIP_CODEC_CONSTEXPR   inline
+#endif
+
+// Bits needed for the values 0 .. span
+constexpr uint8_t acsipCodecBits(uint32_t span)
+{
+    return span ? 1 + acsipCodecBits(span >> 1) : 0;
+}
+
+// Write the low 'bits' of value at bit 'offset', the frame has to start zeroed
+ACSIP_CODEC_CONSTEXPR void acsipPutBits(uint8_t *frame, size_t offset, uint8_t bits, uint32_t value)
+{
+    while (bits) {
+        uint8_t room = 8 - (offset & 7);
+        uint8_t n = bits < room ? bits : room;
+        uint32_t chunk = (value >> (bits - n)) & ((1UL << n) - 1);
+        frame[offset >> 3] |= chunk << (room - n);
+        offset += n;
+        bits -= n;
+    }
+}
+
+ACSIP_CODEC_CONSTEXPR uint32_t acsipGetBits(const uint8_t *frame, size_t offset, uint8_t bits)
+{
+    uint32_t value = 0;
+    while (bits) {
+        uint8_t room = 8 - (offset & 7);
+        uint8_t n = bits < room ? bits : room;
+        value = (value << n) | ((frame[offset >> 3] >> (room - n)) & ((1U << n) - 1));
+        offset += n;
+        bits -= n;
+    }
+    return value;
+}
+
+/**
+ * @brief  AcsipField
+ * @note   Value = raw / Div, raw runs from Min to Max. Div is the number of
+ *         steps per unit: 10 for 0.1, 1 for whole units.
+ */
+template <int32_t Min, int32_t Max, int32_t Div = 1>
+struct AcsipField {
+    static_assert(Min <= Max, "empty range");
+    static_assert(Div > 0, "resolution must be positive");
+    static_assert((int64_t)Max - Min <= 0xFFFFFFFFLL, "range wider than 32 bits");
+
+    static constexpr int32_t min = Min;
+    static constexpr int32_t max = Max;
+    static constexpr int32_t div = Div;
+    static constexpr uint8_t bits = acsipCodecBits((uint32_t)((int64_t)Max - Min));
+
+    // Nearest raw step of a value, clamped to the range
+    static constexpr int32_t quantize(double value)
+    {
+        return value * Div <= Min ? Min :
+               value * Div >= Max ? Max :
+               value < 0 ? (int32_t)(value * Div - 0.5) : (int32_t)(value * Div + 0.5);
+    }
+    static constexpr uint32_t store(int32_t raw)
+    {
+        return raw <= Min ? 0 : raw >= Max ? (uint32_t)((int64_t)Max - Min) : (uint32_t)((int64_t)raw - Min);
+    }
+    static constexpr int32_t load(uint32_t stored)
+    {
+        return (int32_t)((int64_t)stored + Min);
+    }
+    static constexpr double value(int32_t raw)
+    {
+        return (double)raw / Div;
+    }
+};
+
+// Field I of a list
+template <size_t I, typename... Fields>
+struct AcsipFieldAt;
+
+template <typename F, typename... Fields>
+struct AcsipFieldAt<0, F, Fields...> {
+    typedef F type;
+};
+
+template <size_t I, typename F, typename... Fields>
+struct AcsipFieldAt<I, F, Fields...> : AcsipFieldAt < I - 1, Fields... > {};
+
+// Bit offset of field I, the total width for I = field count
+template <size_t I, typename... Fields>
+struct AcsipFieldOffset {
+    static constexpr size_t value = 0;
+};
+
+template <size_t I, typename F, typename... Fields>
+struct AcsipFieldOffset<I, F, Fields...> {
+    static constexpr size_t value = I ? F::bits + AcsipFieldOffset < I ? I - 1 : 0, Fields... >::value : 0;
+};
+
+template <typename... Fields>
+class AcsipSchema
+{
+public:
+    template <size_t I>
+    using Field = typename AcsipFieldAt<I, Fields...>::type;
+
+    template <size_t I>
+    static constexpr size_t offset()
+    {
+        return AcsipFieldOffset<I, Fields...>::value;
+    }
+
+    static constexpr size_t count = sizeof...(Fields);
+    static constexpr size_t bits = AcsipFieldOffset<sizeof...(Fields), Fields...>::value;
+    static constexpr size_t size = (bits + 7) / 8;
+
+    // One value per field, in schema order. Writes all 'size' bytes of frame
+    template <typename... Values>
+    ACSIP_CODEC_CONSTEXPR static void encode(uint8_t *frame, Values... values)
+    {
+        static_assert(sizeof...(Values) == sizeof...(Fields), "one value per field");
+        for (size_t i = 0; i < size; i++) {
+            frame[i] = 0;
+        }
+        put<0>(frame, values...);
+    }
+
+    // Raw steps, for counters and ids that a double would round
+    template <size_t I>
+    ACSIP_CODEC_CONSTEXPR static void setRaw(uint8_t *frame, int32_t raw)
+    {
+        clear(frame, offset<I>(), Field<I>::bits);
+        acsipPutBits(frame, offset<I>(), Field<I>::bits, Field<I>::store(raw));
+    }
+
+    template <size_t I>
+    ACSIP_CODEC_CONSTEXPR static int32_t getRaw(const uint8_t *frame)
+    {
+        return Field<I>::load(acsipGetBits(frame, offset<I>(), Field<I>::bits));
+    }
+
+    template <size_t I>
+    ACSIP_CODEC_CONSTEXPR static double get(const uint8_t *frame)
+    {
+        return Field<I>::value(getRaw<I>(frame));
+    }
+
+    // Every field value, 'values' holds 'count' entries
+    ACSIP_CODEC_CONSTEXPR static void decode(const uint8_t *frame, double *values)
+    {
+        take<0>(frame, values, (const Fields *)0 ...);
+    }
+
+private:
+    template <size_t I>
+    ACSIP_CODEC_CONSTEXPR static void put(uint8_t *)
+    {
+    }
+
+    template <size_t I, typename V, typename... Values>
+    ACSIP_CODEC_CONSTEXPR static void put(uint8_t *frame, V value, Values... rest)
+    {
+        acsipPutBits(frame, offset<I>(), Field<I>::bits, Field<I>::store(Field<I>::quantize(value)));
+        put < I + 1 > (frame, rest...);
+    }
+
+    template <size_t I>
+    ACSIP_CODEC_CONSTEXPR static void take(const uint8_t *, double *)
+    {
+    }
+
+    template <size_t I, typename F, typename... Rest>
+    ACSIP_CODEC_CONSTEXPR static void take(const uint8_t *frame, double *values, const F *, const Rest *... rest)
+    {
+        values[I] = get<I>(frame);
+        take < I + 1 > (frame, values, rest...);
+    }
+
+    ACSIP_CODEC_CONSTEXPR static void clear(uint8_t *frame, size_t offset, uint8_t bits)
+    {
+        for (; bits; offset++, bits--) {
+            frame[offset >> 3] &= ~(0x80 >> (offset & 7));
+        }
+    }
+};
+
+template <typename... Fields>
+constexpr size_t AcsipSchema<Fields...>::bits;
+template <typename... Fields>
+constexpr size_t AcsipSchema<Fields...>::size;
+template <typename... Fields>
+constexpr size_t AcsipSchema<Fields...>::count;
+
+/*****************************************
+ *          ROUND TRIP CHECKS
+ ****************************************/
+namespace acsip_codec_check {
+
+typedef AcsipField<-400, 850, 10> Temperature;
+typedef AcsipField<-900000, 900000, 10000> Latitude;
+typedef AcsipField<0, 0xFFFFFF> Counter;
+
+static_assert(Temperature::bits == 11 && Latitude::bits == 21 && Counter::bits == 24, "field width");
+static_assert(AcsipField<5, 5>::bits == 0 && AcsipField<0, 1>::bits == 1, "field width");
+
+static_assert(Temperature::load(Temperature::store(Temperature::quantize(21.5))) == 215, "round trip");
+static_assert(Temperature::load(Temperature::store(Temperature::quantize(-12.34))) == -123, "negative rounding");
+static_assert(Temperature::load(Temperature::store(Temperature::quantize(-99))) == -400, "clamp low");
+static_assert(Temperature::load(Temperature::store(Temperature::quantize(1000))) == 850, "clamp high");
+static_assert(Latitude::load(Latitude::store(Latitude::quantize(-89.9999))) == -899999, "round trip");
+static_assert(Counter::load(Counter::store(0xABCDEF)) == 0xABCDEF, "round trip");
+
+typedef AcsipSchema<Temperature, AcsipField<0, 1>, Latitude, Counter> Schema;
+static_assert(Schema::bits == 57 && Schema::size == 8, "schema width");
+static_assert(Schema::offset<2>() == 12 && Schema::offset<3>() == 33, "field offset");
+
+#if __cplusplus >= 201402L
+constexpr bool frameRoundTrip(double t, double flag, double lat, double counter)
+{
+    uint8_t frame[Schema::size] = {};
+    Schema::encode(frame, t, flag, lat, counter);
+    return Schema::getRaw<0>(frame) == Temperature::quantize(t) &&
+           Schema::getRaw<1>(frame) == AcsipField<0, 1>::quantize(flag) &&
+           Schema::getRaw<2>(frame) == Latitude::quantize(lat) &&
+           Schema::getRaw<3>(frame) == Counter::quantize(counter);
+}
+
+constexpr bool rawRoundTrip(int32_t raw)
+{
+    uint8_t frame[Schema::size] = {};
+    Schema::encode(frame, 85.0, 1, -90.0, 0xFFFFFF);
+    Schema::setRaw<2>(frame, raw);
+    return Schema::getRaw<2>(frame) == raw && Schema::getRaw<1>(frame) == 1 && Schema::getRaw<3>(frame) == 0xFFFFFF;
+}
+
+static_assert(frameRoundTrip(21.5, 1, 48.8584, 123456), "frame round trip");
+static_assert(frameRoundTrip(-40, 0, -90, 0), "frame round trip at the lower ends");
+static_assert(frameRoundTrip(85, 1, 90, 0xFFFFFF), "frame round trip at the upper ends");
+static_assert(rawRoundTrip(123456), "setRaw keeps the neighbours");
+#endif
+
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * C++20 coroutine front end for the non-blocking engine.
+ *
+ * co_await AcsipCommand(...) queues a command with Acsip::submit and resumes
+ * the coroutine from Acsip::process (or AcsipMux::poll) when the reply is
+ * complete. Any number of AcsipTask sequences, one per module or job, can be
+ * interleaved on a single thread:
+ *
+ *      AcsipTask gps = GPSStartAsync(s76g);
+ *      AcsipTask lora = joinOTAAAsync(s76g);
+ *      while (!gps.done() || !lora.done()) {
+ *          s76g.process();
+ *      }
+ */
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <stdarg.h>
+
+#define ACSIP_HAS_COROUTINE
+
+// Reply of a command, ack holds the last frame
+struct AcsipReply {
+    int  err;
+    char ack[ACSIP_BUFFER_SIZE];
+};
+
+class AcsipTask
+{
+public:
+    struct promise_type {
+        int                     result = S7XG_OK;
+        bool                    finished = false;
+        std::coroutine_handle<> continuation;
+
+        AcsipTask get_return_object()
+        {
+            return AcsipTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+        struct FinalAwaiter {
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+            {
+                h.promise().finished = true;
+                if (h.promise().continuation) {
+                    return h.promise().continuation;
+                }
+                return std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_value(int value)
+        {
+            result = value;
+        }
+        void unhandled_exception()
+        {
+            result = S7XG_FAILED;
+        }
+    };
+
+    AcsipTask(AcsipTask &&other) : _handle(other._handle)
+    {
+        other._handle = nullptr;
+    }
+    AcsipTask(const AcsipTask &) = delete;
+    ~AcsipTask()
+    {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    bool done() const
+    {
+        return !_handle || _handle.promise().finished;
+    }
+    int result() const
+    {
+        return _handle ? _handle.promise().result : S7XG_FAILED;
+    }
+
+    // Awaiting a task from another task resumes the caller when it finishes
+    bool await_ready() const
+    {
+        return done();
+    }
+    void await_suspend(std::coroutine_handle<> caller)
+    {
+        _handle.promise().continuation = caller;
+    }
+    int await_resume() const
+    {
+        return result();
+    }
+
+private:
+    explicit AcsipTask(std::coroutine_handle<promise_type> h) : _handle(h) {}
+    std::coroutine_handle<promise_type> _handle;
+};
+
+class AcsipCommand
+{
+public:
+    /**
+     * @brief  AcsipCommand
+     * @param  acsip: module
+     * @param  frames: reply frames, see Acsip::submit
+     * @param  timeout: ms for the whole exchange, 0 uses the Acsip timeout
+     * @param  format: printf style command line
+     */
+    AcsipCommand(Acsip &acsip, uint8_t frames, uint32_t timeout, const char *format, ...)
+        : _acsip(acsip), _frames(frames), _timeout(timeout)
+    {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(_cmd, sizeof(_cmd), format, args);
+        va_end(args);
+        _reply.err = S7XG_OK;
+        _reply.ack[0] = '\0';
+    }
+    AcsipCommand(const AcsipCommand &) = delete;
+
+    //A task destroyed while suspended here must not be resumed by process()
+    ~AcsipCommand()
+    {
+        if (_queued) {
+            _acsip.cancel(complete, this);
+        }
+    }
+
+    bool await_ready()
+    {
+        return false;
+    }
+    bool await_suspend(std::coroutine_handle<> h)
+    {
+        _handle = h;
+        _reply.err = _acsip.submit(_cmd, complete, this, _frames, _timeout);
+        //Not queued, continue right away with the error
+        _queued = _reply.err == S7XG_OK;
+        return _queued;
+    }
+    AcsipReply await_resume()
+    {
+        return _reply;
+    }
+
+private:
+    static void complete(void *arg, int err, const char *ack)
+    {
+        AcsipCommand *self = (AcsipCommand *)arg;
+        self->_queued = false;
+        self->_reply.err = err;
+        strncpy(self->_reply.ack, ack, sizeof(self->_reply.ack) - 1);
+        self->_reply.ack[sizeof(self->_reply.ack) - 1] = '\0';
+        self->_handle.resume();
+    }
+
+    Acsip                  &_acsip;
+    uint8_t                 _frames;
+    uint32_t                _timeout;
+    char                    _cmd[ACSIP_REQUEST_SIZE];
+    AcsipReply              _reply;
+    std::coroutine_handle<> _handle;
+    bool                    _queued = false;
+};
+
+// Await a single-reply command and map the answer like the blocking setters
+inline AcsipTask setAsync(Acsip &acsip, const char *cmd)
+{
+    AcsipReply reply = co_await AcsipCommand(acsip, 1, 0, "%s", cmd);
+    co_return reply.err == S7XG_OK ? Acsip::ackToError(reply.ack) : reply.err;
+}
+
+/**
+ * @brief  GPSStartAsync
+ * @note   Same sequence as Acsip::GPSStart, without blocking.
+ */
+inline AcsipTask GPSStartAsync(Acsip &acsip,
+                               GPSStartMode type = S7XG_GPS_START_HOT,
+                               GPSMode mode = S7XG_GPS_MODE_MANUAL,
+                               GPSSatelliteSys satellite = S7XG_SATELLITE_GPS,
+                               uint32_t cycle = 5000)
+{
+    if (type >= S7XG_GPS_START_MAX || mode >= S7XG_GPS_MODE_MAX ||
+            satellite >= S7XG_SATELLITE_MAX || cycle < 1000 || cycle > 600000) {
+        co_return S7XG_INVALD;
+    }
+
+    char cmd[64];
+    int ret;
+
+    ret = co_await setAsync(acsip, "gps set_level_shift on");
+    if (ret != S7XG_OK) co_return ret;
+
+    snprintf(cmd, sizeof(cmd), "gps set_start %s", Acsip::gpsStartName(type));
+    ret = co_await setAsync(acsip, cmd);
+    if (ret != S7XG_OK) co_return ret;
+
+    snprintf(cmd, sizeof(cmd), "gps set_satellite_system %s", acsip.satelliteName(satellite));
+    ret = co_await setAsync(acsip, cmd);
+    if (ret != S7XG_OK) co_return ret;
+
+    snprintf(cmd, sizeof(cmd), "gps set_positioning_cycle %u", cycle);
+    ret = co_await setAsync(acsip, cmd);
+    if (ret != S7XG_OK) co_return ret;
+
+    snprintf(cmd, sizeof(cmd), "gps set_mode %s", Acsip::gpsModeName(mode));
+    co_return co_await setAsync(acsip, cmd);
+}
+
+/**
+ * @brief  joinAsync
+ * @note   "mac join" answers "Ok" first and "accepted" or "unsuccess" once the
+ *         join procedure ends, so no get_join_status polling is needed.
+ * @param  type: "otaa" or "abp"
+ * @param  timeout: ms for the whole join procedure
+ */
+inline AcsipTask joinAsync(Acsip &acsip, const char *type, uint32_t timeout = 30000)
+{
+    AcsipReply reply = co_await AcsipCommand(acsip, 2, timeout, "mac join %s", type);
+    co_return reply.err == S7XG_OK ? Acsip::joinToError(reply.ack) : reply.err;
+}
+
+inline AcsipTask joinOTAAAsync(Acsip &acsip, uint32_t timeout = 30000)
+{
+    return joinAsync(acsip, "otaa", timeout);
+}
+
+#endif
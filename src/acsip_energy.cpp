@@ -0,0 +1,206 @@
+#include "acsip_energy.h"
+
+//Typical S76G figures in uA: MCU running, SX1276 at 14 dBm, GNSS tracking
+static const uint32_t defaultCurrent[ACSIP_STATE_MAX] = {
+    6000,       // IDLE
+    20,         // SLEEP
+    44000,      // TX
+    11500,      // RX
+    11500,      // RX_CONTINUOUS
+    0,          // GPS_OFF
+    12000,      // GPS_ACTIVE
+    400,        // GPS_SLEEP
+    15,         // GPS_DEEP_SLEEP
+};
+
+AcsipEnergy::AcsipEnergy() :
+    _sf(7),
+    _bw(125),
+    _cr(5),
+    _preamble(8),
+    _rxWindow(ACSIP_ENERGY_RX_WINDOW)
+{
+    memcpy(_current, defaultCurrent, sizeof(_current));
+    reset();
+}
+
+void AcsipEnergy::attach(Acsip &acsip)
+{
+    reset();
+    acsip.setStateCallback(onState, this);
+}
+
+void AcsipEnergy::onState(void *arg, AcsipState state, uint32_t value)
+{
+    ((AcsipEnergy *)arg)->enter(state, value);
+}
+
+void AcsipEnergy::setCurrent(AcsipState state, uint32_t uA)
+{
+    if (state < ACSIP_STATE_MAX) {
+        update();
+        _current[state] = uA;
+    }
+}
+
+uint32_t AcsipEnergy::getCurrent(AcsipState state)
+{
+    return state < ACSIP_STATE_MAX ? _current[state] : 0;
+}
+
+void AcsipEnergy::setAirtime(uint8_t sf, uint16_t bw, uint8_t cr, uint16_t preamble)
+{
+    _sf = sf;
+    _bw = bw;
+    _cr = cr;
+    _preamble = preamble;
+}
+
+void AcsipEnergy::setRxWindow(uint16_t ms)
+{
+    _rxWindow = ms;
+}
+
+void AcsipEnergy::reset()
+{
+    memset(_time, 0, sizeof(_time));
+    memset(_charge, 0, sizeof(_charge));
+    _radio = ACSIP_STATE_IDLE;
+    _gps = ACSIP_STATE_GPS_OFF;
+    _radioSince = _gpsSince = millis();
+    _budget = _rxBudget = 0;
+}
+
+void AcsipEnergy::account(AcsipState state, uint32_t ms)
+{
+    _time[state] += ms;
+    _charge[state] += (uint64_t)_current[state] * ms;
+}
+
+//Time in a state with a budget is split, what exceeds it was spent idle
+void AcsipEnergy::closeRadio(uint32_t now)
+{
+    uint32_t ms = now - _radioSince;
+    _radioSince = now;
+
+    if (_radio != ACSIP_STATE_TX && _radio != ACSIP_STATE_SLEEP) {
+        account(_radio, ms);
+        return;
+    }
+    uint32_t part = ms < _budget ? ms : _budget;
+    account(_radio, part);
+    _budget -= part;
+    ms -= part;
+
+    part = ms < _rxBudget ? ms : _rxBudget;
+    account(ACSIP_STATE_RX, part);
+    _rxBudget -= part;
+    ms -= part;
+
+    account(ACSIP_STATE_IDLE, ms);
+    if (_budget == 0 && _rxBudget == 0) {
+        _radio = ACSIP_STATE_IDLE;
+    }
+}
+
+void AcsipEnergy::closeGPS(uint32_t now)
+{
+    account(_gps, now - _gpsSince);
+    _gpsSince = now;
+}
+
+void AcsipEnergy::enter(AcsipState state, uint32_t value)
+{
+    uint32_t now = millis();
+    if (state >= ACSIP_STATE_GPS_OFF && state < ACSIP_STATE_MAX) {
+        closeGPS(now);
+        _gps = state;
+        return;
+    }
+    closeRadio(now);
+    _budget = _rxBudget = 0;
+    switch (state) {
+    case ACSIP_STATE_SLEEP:
+        _budget = value * 1000;
+        break;
+    case ACSIP_STATE_TX:
+        _budget = (timeOnAir(value, _sf, _bw, _cr, _preamble) + 999) / 1000;
+        break;
+    case ACSIP_STATE_UPLINK:
+        state = ACSIP_STATE_TX;
+        _budget = (timeOnAir(value, _sf, _bw, _cr, _preamble) + 999) / 1000;
+        _rxBudget = 2 * _rxWindow;
+        break;
+    default:
+        break;
+    }
+    _radio = state;
+}
+
+void AcsipEnergy::update()
+{
+    uint32_t now = millis();
+    closeRadio(now);
+    closeGPS(now);
+}
+
+uint64_t AcsipEnergy::time(AcsipState state)
+{
+    update();
+    return state < ACSIP_STATE_MAX ? _time[state] : 0;
+}
+
+uint64_t AcsipEnergy::elapsed()
+{
+    update();
+    uint64_t ms = 0;
+    //Every radio ms is in exactly one radio state
+    for (int i = ACSIP_STATE_IDLE; i < ACSIP_STATE_GPS_OFF; i++) {
+        ms += _time[i];
+    }
+    return ms;
+}
+
+double AcsipEnergy::mAh(AcsipState state)
+{
+    update();
+    //uA * ms to mAh
+    return state < ACSIP_STATE_MAX ? _charge[state] / 3600000000.0 : 0;
+}
+
+double AcsipEnergy::mAh()
+{
+    update();
+    uint64_t charge = 0;
+    for (int i = 0; i < ACSIP_STATE_MAX; i++) {
+        charge += _charge[i];
+    }
+    return charge / 3600000000.0;
+}
+
+double AcsipEnergy::averageCurrent()
+{
+    uint64_t ms = elapsed();
+    return ms ? mAh() * 3600000.0 / ms : 0;
+}
+
+double AcsipEnergy::batteryLife(double capacity)
+{
+    double mA = averageCurrent();
+    return mA > 0 ? capacity / mA : 0;
+}
+
+//Semtech AN1200.13, low data rate optimization above 16 ms symbols
+uint32_t AcsipEnergy::timeOnAir(size_t len, uint8_t sf, uint16_t bw, uint8_t cr, uint16_t preamble)
+{
+    if (sf < 6 || sf > 12 || bw == 0 || cr < 5 || cr > 8) {
+        return 0;
+    }
+    uint32_t symbol = (1000UL << sf) / bw;          // us
+    int de = symbol > 16000 ? 1 : 0;
+    int32_t num = 8 * (int32_t)len - 4 * sf + 28 + 16;
+    int32_t den = 4 * (sf - 2 * de);
+    int32_t blocks = num > 0 ? (num + den - 1) / den : 0;
+    uint32_t symbols = 8 + blocks * cr;
+    return (4 * preamble + 17) * symbol / 4 + symbols * symbol;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Energy accounting by module state.
+ *
+ * Attached to an Acsip instance, the profiler receives every state change
+ * made by the blocking calls and meters the time spent in each state. The
+ * radio and the GPS are metered separately, their currents add up.
+ *
+ * Transmissions are metered from their LoRa time-on-air, the rest of the
+ * exchange counts as idle. A LoRaWAN uplink adds the two receive windows.
+ * A timed "sip sleep" falls back to idle once its duration has passed.
+ *
+ * The default currents are typical figures for a S76G at 14 dBm, measure
+ * the board and set them with setCurrent for usable projections. Commands
+ * sent through submit/process or written by hand are not metered.
+ */
+
+// Length of one RX1/RX2 window of a LoRaWAN uplink
+#define ACSIP_ENERGY_RX_WINDOW          50
+
+class AcsipEnergy
+{
+public:
+    AcsipEnergy();
+
+    // Install the state callback, the module is assumed idle with the GPS off
+    void attach(Acsip &acsip);
+
+    // Current model, uA drawn in a state
+    void setCurrent(AcsipState state, uint32_t uA);
+    uint32_t getCurrent(AcsipState state);
+
+    /**
+     * @brief  setAirtime
+     * @note   Radio settings for the time-on-air of P2P frames and uplinks.
+     *         For LoRaWAN use the spreading factor of the data rate in use.
+     * @param  sf: spreading factor, 6 to 12
+     * @param  bw: bandwidth in kHz, 125, 250 or 500
+     * @param  cr: coding rate denominator, 5 to 8 for 4/5 to 4/8
+     * @param  preamble: preamble symbols
+     */
+    void setAirtime(uint8_t sf, uint16_t bw, uint8_t cr = 5, uint16_t preamble = 8);
+    void setRxWindow(uint16_t ms);
+
+    // Feed a state change by hand, e.g. for commands sent through submit
+    void enter(AcsipState state, uint32_t value = 0);
+
+    // Account the time up to now, the getters call it
+    void update();
+    void reset();
+
+    uint64_t time(AcsipState state);        // ms
+    uint64_t elapsed();                     // ms since attach or reset
+    double   mAh(AcsipState state);
+    double   mAh();
+    double   averageCurrent();              // mA
+
+    // Hours a battery of 'capacity' mAh lasts at the average current so far
+    double   batteryLife(double capacity);
+
+    // LoRa time-on-air in us, explicit header and CRC on
+    static uint32_t timeOnAir(size_t len, uint8_t sf, uint16_t bw, uint8_t cr = 5, uint16_t preamble = 8);
+
+private:
+    static void onState(void *arg, AcsipState state, uint32_t value);
+    void account(AcsipState state, uint32_t ms);
+    void closeRadio(uint32_t now);
+    void closeGPS(uint32_t now);
+
+    uint32_t    _current[ACSIP_STATE_MAX];
+    uint64_t    _time[ACSIP_STATE_MAX];
+    uint64_t    _charge[ACSIP_STATE_MAX];       // uA * ms
+    uint8_t     _sf;
+    uint16_t    _bw;
+    uint8_t     _cr;
+    uint16_t    _preamble;
+    uint16_t    _rxWindow;
+
+    AcsipState  _radio;
+    uint32_t    _radioSince;
+    uint32_t    _budget;        // ms left in _radio before falling back to idle
+    uint32_t    _rxBudget;      // ms of RX windows left after an uplink
+    AcsipState  _gps;
+    uint32_t    _gpsSince;
+};
@@ -0,0 +1,316 @@
+#include "acsip_firmware.h"
+#include <string.h>
+
+const AcsipFirmwareImage acsipFirmwareImages[] = {
+    {"LoRaWAN-S76G-AS923-V1-6-6-G11.hex", "S76G", "AS923", "v1.6.6-g11", 127960, 0x03383E73},
+    {"LoRaWAN-S76G-EU868-V1-6-5-G9.hex",  "S76G", "EU868", "v1.6.5-g9",  125948, 0x16FC787C},
+    {"LoRaWAN-S76G-EU868-V1-6-6-G11.hex", "S76G", "EU868", "v1.6.6-g11", 127460, 0x55EB18DB},
+    {"LoRaWAN-S76G-US915-V1-6-5-G9.hex",  "S76G", "US915", "v1.6.5-g9",  124984, 0x027A9F9D},
+    {"LoRaWAN-S76G-US915-V1-6-6-G11.hex", "S76G", "US915", "v1.6.6-g11", 126352, 0x1117DF0B},
+    {"LoRaWAN-S76S-AS923-V1-6-5-G9.hex",  "S76S", "AS923", "v1.6.5",     111848, 0x6E7FA7B6},
+    {"LoRaWAN-S78G-CN470-V1-6-5-G9.hex",  "S78G", "CN470", "v1.6.5-g9",  124424, 0x99116DB0},
+    {"LoRaWAN-S78G-CN470-V1-6-6-G11.hex", "S78G", "CN470", "v1.6.6-g11", 125912, 0x92474FAB},
+};
+
+const size_t acsipFirmwareImageCount = sizeof(acsipFirmwareImages) / sizeof(acsipFirmwareImages[0]);
+
+static const char *regions[] = {"AS923", "AU915", "CN470", "EU868", "IN865", "KR920", "US915"};
+static const char *models[] = {"S76G", "S76S", "S78G", "S78S"};
+
+static inline int hexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+static uint32_t crcByte(uint32_t crc, uint8_t b)
+{
+    crc = ~crc ^ b;
+    for (uint8_t k = 0; k < 8; k++) {
+        crc = (crc >> 1) ^ (0xEDB88320UL & -(crc & 1));
+    }
+    return ~crc;
+}
+
+AcsipHexDecoder::AcsipHexDecoder()
+{
+    reset();
+}
+
+void AcsipHexDecoder::reset()
+{
+    _error = ACSIP_HEX_OK;
+    _inRecord = false;
+    _eof = false;
+    _base = 0;
+    _records = 0;
+    _size = 0;
+    _crc = 0;
+    _start = UINT32_MAX;
+    _end = 0;
+    _entry = 0;
+    _runLen = 0;
+    _model[0] = _region[0] = _version[0] = '\0';
+}
+
+void AcsipHexDecoder::fail(AcsipHexError err)
+{
+    if (_error == ACSIP_HEX_OK) {
+        _error = err;
+    }
+}
+
+bool AcsipHexDecoder::feed(const char *data, size_t len)
+{
+    for (size_t i = 0; i < len && _error == ACSIP_HEX_OK; i++) {
+        feed(data[i]);
+    }
+    return _error == ACSIP_HEX_OK;
+}
+
+bool AcsipHexDecoder::feed(char c)
+{
+    if (_error != ACSIP_HEX_OK) {
+        return false;
+    }
+    if (!_inRecord) {
+        if (c == ':') {
+            if (_eof) {
+                fail(ACSIP_HEX_SYNTAX);
+                return false;
+            }
+            _inRecord = true;
+            _high = true;
+            _index = 0;
+            _sum = 0;
+            _value = 0;
+        } else if (c != '\r' && c != '\n' && c != ' ' && c != '\t') {
+            fail(ACSIP_HEX_SYNTAX);
+        }
+        return _error == ACSIP_HEX_OK;
+    }
+
+    int v = hexValue(c);
+    if (v < 0) {
+        fail(ACSIP_HEX_SYNTAX);
+        return false;
+    }
+    if (_high) {
+        _nibble = v;
+        _high = false;
+    } else {
+        _high = true;
+        byte((_nibble << 4) | v);
+    }
+    return _error == ACSIP_HEX_OK;
+}
+
+void AcsipHexDecoder::byte(uint8_t b)
+{
+    _sum += b;
+    switch (_index) {
+    case 0:
+        _len = b;
+        break;
+    case 1:
+        _offset = b << 8;
+        break;
+    case 2:
+        _offset |= b;
+        break;
+    case 3:
+        _type = b;
+        if (_type > 5) {
+            fail(ACSIP_HEX_RECORD);
+            return;
+        }
+        break;
+    default:
+        if (_index < 4 + _len) {
+            if (_type == 0) {
+                data(b);
+            } else {
+                _value = (_value << 8) | b;
+            }
+        } else {
+            endOfRecord();
+            return;
+        }
+        break;
+    }
+    _index++;
+}
+
+void AcsipHexDecoder::data(uint8_t b)
+{
+    uint32_t addr = _base + _offset + (_index - 4);
+    if (addr < _start) _start = addr;
+    if (addr + 1 > _end) _end = addr + 1;
+    _crc = crcByte(_crc, b);
+    _size++;
+    text((char)b);
+}
+
+void AcsipHexDecoder::text(char c)
+{
+    //Printable runs are matched when they end
+    if (c >= ' ' && c <= '~') {
+        if (_runLen < sizeof(_run) - 1) {
+            _run[_runLen] = c;
+        }
+        _runLen++;
+        return;
+    }
+    if (_runLen >= 4 && _runLen < sizeof(_run)) {
+        _run[_runLen] = '\0';
+        if (!_version[0] && _run[0] == 'v' && _run[1] >= '0' && _run[1] <= '9' && _run[2] == '.') {
+            strcpy(_version, _run);
+        }
+        for (size_t i = 0; !_region[0] && i < sizeof(regions) / sizeof(regions[0]); i++) {
+            if (strcmp(_run, regions[i]) == 0) {
+                strcpy(_region, _run);
+            }
+        }
+        for (size_t i = 0; !_model[0] && i < sizeof(models) / sizeof(models[0]); i++) {
+            if (strcmp(_run, models[i]) == 0) {
+                strcpy(_model, _run);
+            }
+        }
+    }
+    _runLen = 0;
+}
+
+void AcsipHexDecoder::endOfRecord()
+{
+    _inRecord = false;
+    _records++;
+    if (_sum != 0) {
+        fail(ACSIP_HEX_CHECKSUM);
+        return;
+    }
+    switch (_type) {
+    case 1:
+        if (_len != 0) fail(ACSIP_HEX_RECORD);
+        _eof = true;
+        break;
+    case 2:
+        if (_len != 2) fail(ACSIP_HEX_RECORD);
+        _base = _value << 4;
+        break;
+    case 4:
+        if (_len != 2) fail(ACSIP_HEX_RECORD);
+        _base = _value << 16;
+        break;
+    case 3:
+    case 5:
+        if (_len != 4) fail(ACSIP_HEX_RECORD);
+        _entry = _value;
+        break;
+    default:
+        break;
+    }
+}
+
+AcsipHexError AcsipHexDecoder::finish()
+{
+    if (_error == ACSIP_HEX_OK && (!_eof || _inRecord)) {
+        fail(ACSIP_HEX_TRUNCATED);
+    }
+    return _error;
+}
+
+AcsipHexError AcsipHexDecoder::error() const
+{
+    return _error;
+}
+
+uint32_t AcsipHexDecoder::line() const
+{
+    return _records + (_inRecord ? 1 : 0);
+}
+
+uint32_t AcsipHexDecoder::records() const
+{
+    return _records;
+}
+
+uint32_t AcsipHexDecoder::size() const
+{
+    return _size;
+}
+
+uint32_t AcsipHexDecoder::crc() const
+{
+    return _crc;
+}
+
+uint32_t AcsipHexDecoder::start() const
+{
+    return _size ? _start : 0;
+}
+
+uint32_t AcsipHexDecoder::end() const
+{
+    return _end;
+}
+
+uint32_t AcsipHexDecoder::entry() const
+{
+    return _entry;
+}
+
+const char *AcsipHexDecoder::model() const
+{
+    return _model;
+}
+
+const char *AcsipHexDecoder::region() const
+{
+    return _region;
+}
+
+const char *AcsipHexDecoder::version() const
+{
+    return _version;
+}
+
+const AcsipFirmwareImage *acsipFirmwareByCrc(uint32_t crc, uint32_t size)
+{
+    for (size_t i = 0; i < acsipFirmwareImageCount; i++) {
+        if (acsipFirmwareImages[i].crc == crc && acsipFirmwareImages[i].size == size) {
+            return &acsipFirmwareImages[i];
+        }
+    }
+    return NULL;
+}
+
+const AcsipFirmwareImage *acsipFirmwareFind(const char *model, const char *region, const char *version)
+{
+    for (size_t i = 0; i < acsipFirmwareImageCount; i++) {
+        const AcsipFirmwareImage &img = acsipFirmwareImages[i];
+        if ((!model || strcmp(model, img.model) == 0) &&
+                (!region || strcmp(region, img.region) == 0) &&
+                (!version || strcmp(version, img.version) == 0)) {
+            return &img;
+        }
+    }
+    return NULL;
+}
+
+const char *acsipFirmwareRegion(int band)
+{
+    switch (band) {
+    case 470:
+        return "CN470";
+    case 868:
+        return "EU868";
+    case 915:
+        return "US915";
+    case 923:
+        return "AS923";
+    default:
+        return NULL;
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Streaming Intel HEX decoder and identification of the images in firmware/.
+ *
+ * Characters are fed in any chunk size, a record is decoded as its digits
+ * arrive and only the running state is kept, so a whole image is checked
+ * without holding a line or the file in memory. Every record checksum is
+ * verified and a CRC-32 is computed over the data bytes in file order.
+ *
+ * The firmware embeds its model ("S76G"), region ("EU868") and version
+ * ("v1.6.6-g11") as plain strings, they are picked up while decoding.
+ *
+ * Only the C library is used, extras/fw_identify builds it on Linux.
+ */
+
+#define ACSIP_FW_STRING_SIZE            24
+
+enum AcsipHexError {
+    ACSIP_HEX_OK,
+    ACSIP_HEX_SYNTAX,           // not a hex digit, or data after the EOF record
+    ACSIP_HEX_CHECKSUM,
+    ACSIP_HEX_RECORD,           // unknown record type or bad record length
+    ACSIP_HEX_TRUNCATED,        // no EOF record
+};
+
+struct AcsipFirmwareImage {
+    const char *file;
+    const char *model;
+    const char *region;
+    const char *version;
+    uint32_t    size;           // data bytes
+    uint32_t    crc;            // CRC-32 of the data bytes
+};
+
+class AcsipHexDecoder
+{
+public:
+    AcsipHexDecoder();
+
+    void reset();
+
+    // Returns false once an error is found, later input is ignored
+    bool feed(char c);
+    bool feed(const char *data, size_t len);
+
+    // ACSIP_HEX_OK only after a clean EOF record
+    AcsipHexError finish();
+
+    AcsipHexError error() const;
+    uint32_t line() const;          // record of the first error
+    uint32_t records() const;
+    uint32_t size() const;
+    uint32_t crc() const;
+    uint32_t start() const;         // lowest data address
+    uint32_t end() const;           // highest data address + 1
+    uint32_t entry() const;         // start linear address record
+
+    const char *model() const;
+    const char *region() const;
+    const char *version() const;
+
+private:
+    void fail(AcsipHexError err);
+    void byte(uint8_t b);
+    void data(uint8_t b);
+    void text(char c);
+    void endOfRecord();
+
+    AcsipHexError   _error;
+    bool            _inRecord;
+    bool            _eof;
+    bool            _high;          // next digit is the high nibble
+    uint8_t         _nibble;
+    uint16_t        _index;         // byte index in the record
+    uint8_t         _len;
+    uint8_t         _type;
+    uint8_t         _sum;
+    uint16_t        _offset;
+    uint32_t        _base;
+    uint32_t        _value;         // payload of address records
+    uint32_t        _records;
+    uint32_t        _size;
+    uint32_t        _crc;
+    uint32_t        _start;
+    uint32_t        _end;
+    uint32_t        _entry;
+
+    char            _run[ACSIP_FW_STRING_SIZE];
+    uint8_t         _runLen;
+    char            _model[ACSIP_FW_STRING_SIZE];
+    char            _region[ACSIP_FW_STRING_SIZE];
+    char            _version[ACSIP_FW_STRING_SIZE];
+};
+
+// Images shipped in firmware/
+extern const AcsipFirmwareImage acsipFirmwareImages[];
+extern const size_t acsipFirmwareImageCount;
+
+// Known image with this CRC and size, NULL if none
+const AcsipFirmwareImage *acsipFirmwareByCrc(uint32_t crc, uint32_t size);
+
+/**
+ * @brief  acsipFirmwareFind
+ * @param  model: "sip get_hw_model" answer, NULL matches any
+ * @param  region: "EU868", see acsipFirmwareRegion, NULL matches any
+ * @param  version: "sip get_ver" answer, NULL matches any
+ * @retval first matching image, NULL if none
+ */
+const AcsipFirmwareImage *acsipFirmwareFind(const char *model, const char *region, const char *version);
+
+// Region name for the "mac get_band" answer (470, 868, 915, 923), NULL if unknown
+const char *acsipFirmwareRegion(int band);
@@ -0,0 +1,269 @@
+#include "acsip_geofence.h"
+
+// m per micro degree of latitude
+#define METER_PER_UDEG      0.11132f
+
+static inline int32_t toMicro(double deg)
+{
+    return (int32_t)lround(deg * 1e6);
+}
+
+AcsipGeofence::AcsipGeofence() :
+    _cb(NULL),
+    _arg(NULL)
+{
+    clear();
+}
+
+void AcsipGeofence::clear()
+{
+    _fenceCount = 0;
+    _vertexCount = 0;
+    _indexed = false;
+    memset(_inside, 0, sizeof(_inside));
+}
+
+uint16_t AcsipGeofence::count()
+{
+    return _fenceCount;
+}
+
+void AcsipGeofence::setCallback(geofence_callback cb, void *arg)
+{
+    _cb = cb;
+    _arg = arg;
+}
+
+int AcsipGeofence::addCircle(uint16_t id, double lat, double lng, float radius)
+{
+    if (radius <= 0 || lat < -90 || lat > 90 || lng < -180 || lng > 180) {
+        return S7XG_INVALD;
+    }
+    if (_fenceCount >= ACSIP_GEOFENCE_MAX || _vertexCount >= ACSIP_GEOFENCE_VERTICES) {
+        return S7XG_FAILED;
+    }
+    Fence &f = _fences[_fenceCount];
+    GeofencePoint &c = _vertices[_vertexCount];
+    c.lat = toMicro(lat);
+    c.lng = toMicro(lng);
+
+    float cosLat = cos(lat * M_PI / 180);
+    int32_t dLat = (int32_t)(radius / METER_PER_UDEG) + 1;
+    int32_t dLng = cosLat > 0.01f ? (int32_t)(radius / (METER_PER_UDEG * cosLat)) + 1 : 180000000;
+    f.id = id;
+    f.first = _vertexCount;
+    f.vertices = 0;
+    f.radius = radius;
+    f.minLat = c.lat - dLat;
+    f.maxLat = c.lat + dLat;
+    f.minLng = c.lng - dLng;
+    f.maxLng = c.lng + dLng;
+
+    _vertexCount++;
+    _fenceCount++;
+    _indexed = false;
+    return S7XG_OK;
+}
+
+int AcsipGeofence::addPolygon(uint16_t id, const GeofencePoint *points, uint16_t count)
+{
+    if (points == NULL || count < 3) {
+        return S7XG_INVALD;
+    }
+    if (_fenceCount >= ACSIP_GEOFENCE_MAX || _vertexCount + count > ACSIP_GEOFENCE_VERTICES) {
+        return S7XG_FAILED;
+    }
+    Fence &f = _fences[_fenceCount];
+    f.id = id;
+    f.first = _vertexCount;
+    f.vertices = count;
+    f.radius = 0;
+    f.minLat = f.maxLat = points[0].lat;
+    f.minLng = f.maxLng = points[0].lng;
+    for (uint16_t i = 0; i < count; i++) {
+        _vertices[_vertexCount + i] = points[i];
+        if (points[i].lat < f.minLat) f.minLat = points[i].lat;
+        if (points[i].lat > f.maxLat) f.maxLat = points[i].lat;
+        if (points[i].lng < f.minLng) f.minLng = points[i].lng;
+        if (points[i].lng > f.maxLng) f.maxLng = points[i].lng;
+    }
+    _vertexCount += count;
+    _fenceCount++;
+    _indexed = false;
+    return S7XG_OK;
+}
+
+bool AcsipGeofence::cellOf(int32_t lat, int32_t lng, uint8_t &row, uint8_t &col)
+{
+    int64_t r = ((int64_t)lat - _minLat) / _cellLat;
+    int64_t c = ((int64_t)lng - _minLng) / _cellLng;
+    if (lat < _minLat || lng < _minLng || r >= ACSIP_GEOFENCE_GRID || c >= ACSIP_GEOFENCE_GRID) {
+        return false;
+    }
+    row = r;
+    col = c;
+    return true;
+}
+
+bool AcsipGeofence::build()
+{
+    _indexed = false;
+    if (_fenceCount == 0) {
+        return true;
+    }
+
+    int32_t maxLat = _fences[0].maxLat, maxLng = _fences[0].maxLng;
+    _minLat = _fences[0].minLat;
+    _minLng = _fences[0].minLng;
+    for (uint16_t i = 1; i < _fenceCount; i++) {
+        if (_fences[i].minLat < _minLat) _minLat = _fences[i].minLat;
+        if (_fences[i].minLng < _minLng) _minLng = _fences[i].minLng;
+        if (_fences[i].maxLat > maxLat) maxLat = _fences[i].maxLat;
+        if (_fences[i].maxLng > maxLng) maxLng = _fences[i].maxLng;
+    }
+    _cellLat = (int32_t)(((int64_t)maxLat - _minLat) / ACSIP_GEOFENCE_GRID) + 1;
+    _cellLng = (int32_t)(((int64_t)maxLng - _minLng) / ACSIP_GEOFENCE_GRID) + 1;
+
+    //Count the fences per cell, then turn the counts into start offsets
+    memset(_cells, 0, sizeof(_cells));
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < _fenceCount; i++) {
+        uint8_t r0, c0, r1, c1;
+        cellOf(_fences[i].minLat, _fences[i].minLng, r0, c0);
+        cellOf(_fences[i].maxLat, _fences[i].maxLng, r1, c1);
+        for (uint8_t r = r0; r <= r1; r++) {
+            for (uint8_t c = c0; c <= c1; c++) {
+                _cells[r * ACSIP_GEOFENCE_GRID + c + 1]++;
+                total++;
+            }
+        }
+    }
+    if (total > ACSIP_GEOFENCE_INDEX_SIZE) {
+        return false;
+    }
+    for (uint16_t c = 0; c < ACSIP_GEOFENCE_GRID * ACSIP_GEOFENCE_GRID; c++) {
+        _cells[c + 1] += _cells[c];
+    }
+
+    //Fill using the start offsets as cursors, each one ends up at the start
+    //of the next cell, so shift them back by one afterwards
+    for (uint16_t i = 0; i < _fenceCount; i++) {
+        uint8_t r0, c0, r1, c1;
+        cellOf(_fences[i].minLat, _fences[i].minLng, r0, c0);
+        cellOf(_fences[i].maxLat, _fences[i].maxLng, r1, c1);
+        for (uint8_t r = r0; r <= r1; r++) {
+            for (uint8_t c = c0; c <= c1; c++) {
+                _index[_cells[r * ACSIP_GEOFENCE_GRID + c]++] = i;
+            }
+        }
+    }
+    for (uint16_t c = ACSIP_GEOFENCE_GRID * ACSIP_GEOFENCE_GRID; c > 0; c--) {
+        _cells[c] = _cells[c - 1];
+    }
+    _cells[0] = 0;
+    _indexed = true;
+    return true;
+}
+
+bool AcsipGeofence::contains(const Fence &f, int32_t lat, int32_t lng)
+{
+    if (lat < f.minLat || lat > f.maxLat || lng < f.minLng || lng > f.maxLng) {
+        return false;
+    }
+    const GeofencePoint *v = &_vertices[f.first];
+    if (f.vertices == 0) {
+        //Equirectangular distance, good to well under 1% for fence sized radii
+        float dy = (lat - v->lat) * METER_PER_UDEG;
+        float dx = (lng - v->lng) * METER_PER_UDEG * cos(v->lat * 1e-6 * M_PI / 180);
+        return dx * dx + dy * dy <= f.radius * f.radius;
+    }
+    //Even-odd ray casting along the longitude axis
+    bool in = false;
+    for (uint16_t i = 0, j = f.vertices - 1; i < f.vertices; j = i++) {
+        const GeofencePoint &a = v[i];
+        const GeofencePoint &b = v[j];
+        if ((a.lat > lat) != (b.lat > lat)) {
+            int64_t cross = (int64_t)(b.lng - a.lng) * (lat - a.lat);
+            int64_t dLat = (int64_t)b.lat - a.lat;
+            //lng < a.lng + cross / dLat, without the division
+            int64_t lhs = ((int64_t)lng - a.lng) * dLat;
+            if (dLat > 0 ? lhs < cross : lhs > cross) {
+                in = !in;
+            }
+        }
+    }
+    return in;
+}
+
+int AcsipGeofence::check(double lat, double lng)
+{
+    int32_t la = toMicro(lat);
+    int32_t lo = toMicro(lng);
+    uint32_t now[(ACSIP_GEOFENCE_MAX + 31) / 32];
+    uint16_t words = (_fenceCount + 31) / 32;
+    memset(now, 0, sizeof(now));
+
+    if (_indexed) {
+        uint8_t r, c;
+        if (cellOf(la, lo, r, c)) {
+            uint16_t cell = r * ACSIP_GEOFENCE_GRID + c;
+            for (uint16_t k = _cells[cell]; k < _cells[cell + 1]; k++) {
+                uint16_t i = _index[k];
+                if (contains(_fences[i], la, lo)) {
+                    now[i / 32] |= 1UL << (i % 32);
+                }
+            }
+        }
+    } else {
+        for (uint16_t i = 0; i < _fenceCount; i++) {
+            if (contains(_fences[i], la, lo)) {
+                now[i / 32] |= 1UL << (i % 32);
+            }
+        }
+    }
+
+    //Fences outside the cell can only matter if they were inside before
+    int events = 0;
+    for (uint16_t w = 0; w < words; w++) {
+        uint32_t changed = _inside[w] ^ now[w];
+        _inside[w] = now[w];
+        for (uint8_t b = 0; changed; b++, changed >>= 1) {
+            if (!(changed & 1)) {
+                continue;
+            }
+            events++;
+            if (_cb) {
+                _cb(_fences[w * 32 + b].id, (now[w] >> b) & 1 ? S7XG_GEOFENCE_ENTER : S7XG_GEOFENCE_EXIT, _arg);
+            }
+        }
+    }
+    return events;
+}
+
+int AcsipGeofence::check(const GPSDataStruct &fix)
+{
+    if (!fix.isValid) {
+        return 0;
+    }
+    double lat, lng;
+    Acsip::toDegrees(fix, lat, lng);
+    return check(lat, lng);
+}
+
+int AcsipGeofence::check(const GPSNmeaFix &fix)
+{
+    if (!fix.isValid) {
+        return 0;
+    }
+    return check(fix.lat, fix.lng);
+}
+
+bool AcsipGeofence::inside(uint16_t id)
+{
+    for (uint16_t i = 0; i < _fenceCount; i++) {
+        if (_fences[i].id == id && (_inside[i / 32] & (1UL << (i % 32)))) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "acsip.h"
+#include "acsip_nmea.h"
+
+/*
+ * Geofencing against circles and polygons.
+ *
+ * After the fences are added, build() spreads them over a uniform grid of
+ * ACSIP_GEOFENCE_GRID x ACSIP_GEOFENCE_GRID cells covering their bounding
+ * box. A fix only tests the fences registered in its cell, so the cost of
+ * a check depends on how many fences overlap there, not on how many exist.
+ * Enter and exit events are raised on transitions only.
+ *
+ * All tables live in the object, RAM per instance on a 32-bit MCU is about
+ *
+ *   28 * ACSIP_GEOFENCE_MAX + 8 * ACSIP_GEOFENCE_VERTICES
+ *   + 2 * ACSIP_GEOFENCE_GRID^2 + 2 * ACSIP_GEOFENCE_INDEX_SIZE + 40
+ *
+ * which is about 12.2 KB with the defaults (256 fences, 512 vertices). A
+ * circle takes one vertex, a polygon one per corner, so lower the vertex
+ * pool first when only circles are used. build() keeps no table on the
+ * stack, check() keeps ACSIP_GEOFENCE_MAX / 8 bytes of state bits there.
+ */
+
+#ifndef ACSIP_GEOFENCE_MAX
+#define ACSIP_GEOFENCE_MAX              256
+#endif
+
+// Polygon vertices shared by all fences
+#ifndef ACSIP_GEOFENCE_VERTICES
+#define ACSIP_GEOFENCE_VERTICES         512
+#endif
+
+#ifndef ACSIP_GEOFENCE_GRID
+#define ACSIP_GEOFENCE_GRID             8
+#endif
+
+// Fence references over all cells, a fence covering n cells uses n entries
+#ifndef ACSIP_GEOFENCE_INDEX_SIZE
+#define ACSIP_GEOFENCE_INDEX_SIZE       512
+#endif
+
+enum GeofenceEvent {
+    S7XG_GEOFENCE_ENTER,
+    S7XG_GEOFENCE_EXIT,
+};
+
+struct GeofencePoint {
+    int32_t lat;            // micro degree
+    int32_t lng;            // micro degree
+};
+
+typedef void (*geofence_callback)(uint16_t id, GeofenceEvent event, void *arg);
+
+class AcsipGeofence
+{
+public:
+    AcsipGeofence();
+
+    void clear();
+
+    /**
+     * @brief  addCircle
+     * @param  id: reported with the events
+     * @param  lat: decimal degree
+     * @param  lng: decimal degree
+     * @param  radius: m
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int addCircle(uint16_t id, double lat, double lng, float radius);
+
+    /**
+     * @brief  addPolygon
+     * @param  id: reported with the events
+     * @param  points: vertices in micro degree, the last edge closes the polygon
+     * @param  count: at least 3
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int addPolygon(uint16_t id, const GeofencePoint *points, uint16_t count);
+
+    /**
+     * @brief  build
+     * @note   Call after the last add, checks before build scan every fence.
+     * @retval false if the grid index ran out of entries, checks then
+     *         scan every fence
+     */
+    bool build();
+
+    void setCallback(geofence_callback cb, void *arg = NULL);
+
+    /**
+     * @brief  check
+     * @param  lat: decimal degree
+     * @param  lng: decimal degree
+     * @retval number of enter/exit events raised
+     */
+    int check(double lat, double lng);
+    int check(const GPSDataStruct &fix);
+    int check(const GPSNmeaFix &fix);
+
+    // Is the last checked position inside the fence with this id
+    bool inside(uint16_t id);
+
+    uint16_t count();
+
+private:
+    struct Fence {
+        uint16_t id;
+        uint16_t first;         // first vertex, circles use one as center
+        uint16_t vertices;      // 0 for a circle
+        float    radius;
+        int32_t  minLat, maxLat, minLng, maxLng;
+    };
+
+    bool contains(const Fence &fence, int32_t lat, int32_t lng);
+    bool cellOf(int32_t lat, int32_t lng, uint8_t &row, uint8_t &col);
+
+    geofence_callback _cb;
+    void           *_arg;
+    Fence           _fences[ACSIP_GEOFENCE_MAX];
+    GeofencePoint   _vertices[ACSIP_GEOFENCE_VERTICES];
+    uint16_t        _fenceCount;
+    uint16_t        _vertexCount;
+
+    // Compressed rows: fences of cell c are _index[_cells[c] .. _cells[c + 1])
+    uint16_t        _cells[ACSIP_GEOFENCE_GRID * ACSIP_GEOFENCE_GRID + 1];
+    uint16_t        _index[ACSIP_GEOFENCE_INDEX_SIZE];
+    bool            _indexed;
+    int32_t         _minLat, _minLng;
+    int32_t         _cellLat, _cellLng;
+
+    uint32_t        _inside[(ACSIP_GEOFENCE_MAX + 31) / 32];
+};
@@ -0,0 +1,223 @@
+#include "acsip_gps_scheduler.h"
+
+static const uint32_t settleTime[S7XG_GPS_ACCURACY_MAX] = {0, 5000, 20000};
+
+AcsipGPSScheduler::AcsipGPSScheduler(Acsip &acsip) :
+    _acsip(acsip),
+    _state(S7XG_GPS_SCHED_STOPPED),
+    _accuracy(S7XG_GPS_ACCURACY_LOW),
+    _level(S7XG_GPS_SLEEP),
+    _start(S7XG_GPS_START_COLD),
+    _cb(NULL),
+    _interval(0),
+    _hasFix(false),
+    _acquireMa(ACSIP_GPS_ACQUIRE_MA),
+    _sleepMa(ACSIP_GPS_SLEEP_MA),
+    _deepSleepMa(ACSIP_GPS_DEEP_SLEEP_MA),
+    _fixes(0),
+    _failures(0)
+{
+    _ttff[S7XG_GPS_START_HOT] = ACSIP_GPS_TTFF_HOT;
+    _ttff[S7XG_GPS_START_WARM] = ACSIP_GPS_TTFF_WARM;
+    _ttff[S7XG_GPS_START_COLD] = ACSIP_GPS_TTFF_COLD;
+}
+
+int AcsipGPSScheduler::begin(uint32_t interval, GPSAccuracy accuracy)
+{
+    if (interval < 1000 || accuracy >= S7XG_GPS_ACCURACY_MAX) {
+        return S7XG_INVALD;
+    }
+    _interval = interval;
+    _accuracy = accuracy;
+    _hasFix = false;
+    _start = S7XG_GPS_START_COLD;
+
+    int ret = _acsip.GPSStart(_start, S7XG_GPS_MODE_MANUAL);
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    uint32_t now = millis();
+    _nextFix = now;
+    _acquireStart = now;
+    _lastPoll = now;
+    _fixed = false;
+    _state = S7XG_GPS_SCHED_ACQUIRING;
+    return S7XG_OK;
+}
+
+void AcsipGPSScheduler::end()
+{
+    if (_state == S7XG_GPS_SCHED_SLEEPING) {
+        _acsip.gpsWakeup();
+    }
+    _acsip.GPSStop();
+    _state = S7XG_GPS_SCHED_STOPPED;
+}
+
+void AcsipGPSScheduler::setCurrent(float acquireMa, float sleepMa, float deepSleepMa)
+{
+    _acquireMa = acquireMa;
+    _sleepMa = sleepMa;
+    _deepSleepMa = deepSleepMa;
+}
+
+void AcsipGPSScheduler::setCallback(gps_fix_callback cb)
+{
+    _cb = cb;
+}
+
+GPSSchedulerState AcsipGPSScheduler::getState()
+{
+    return _state;
+}
+
+GPSSleepLevel AcsipGPSScheduler::getSleepLevel()
+{
+    return _level;
+}
+
+float AcsipGPSScheduler::getTtff(GPSStartMode mode)
+{
+    return mode < S7XG_GPS_START_MAX ? _ttff[mode] : 0;
+}
+
+uint32_t AcsipGPSScheduler::getFixes()
+{
+    return _fixes;
+}
+
+uint32_t AcsipGPSScheduler::getFailures()
+{
+    return _failures;
+}
+
+GPSStartMode AcsipGPSScheduler::startMode(GPSSleepLevel level, uint32_t now)
+{
+    if (!_hasFix) {
+        return S7XG_GPS_START_COLD;
+    }
+    //The ephemeris is counted from the last fix, not from now
+    uint32_t age = now - _lastFix + _interval;
+    if (age > ACSIP_GPS_EPHEMERIS_AGE) {
+        return S7XG_GPS_START_WARM;
+    }
+    return level == S7XG_GPS_SLEEP ? S7XG_GPS_START_HOT : S7XG_GPS_START_WARM;
+}
+
+float AcsipGPSScheduler::estimate(GPSSleepLevel level)
+{
+    float on = _ttff[startMode(level, millis())] + settleTime[_accuracy] / 1000.0f;
+    float period = _interval / 1000.0f;
+    float off = period > on ? period - on : 0;
+    float sleepMa = level == S7XG_GPS_SLEEP ? _sleepMa : _deepSleepMa;
+    // mA * s -> uAh
+    return (on * _acquireMa + off * sleepMa) * 1000.0f / 3600.0f;
+}
+
+float AcsipGPSScheduler::getEnergyPerFix()
+{
+    return estimate(_level);
+}
+
+void AcsipGPSScheduler::learn(GPSStartMode mode, float ttff)
+{
+    if (ttff <= 0) {
+        return;
+    }
+    //Exponential moving average, new samples weigh 1/4
+    _ttff[mode] += (ttff - _ttff[mode]) / 4;
+}
+
+int AcsipGPSScheduler::wake(uint32_t now)
+{
+    int ret = _acsip.gpsWakeup();
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    ret = _acsip.setStart(_start);
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    ret = _acsip.setMode(S7XG_GPS_MODE_MANUAL);
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    _acquireStart = now;
+    _lastPoll = now;
+    _fixed = false;
+    _state = S7XG_GPS_SCHED_ACQUIRING;
+    return S7XG_OK;
+}
+
+int AcsipGPSScheduler::sleep()
+{
+    uint32_t now = millis();
+
+    _level = estimate(S7XG_GPS_DEEP_SLEEP) < estimate(S7XG_GPS_SLEEP) ? S7XG_GPS_DEEP_SLEEP : S7XG_GPS_SLEEP;
+    _start = startMode(_level, now);
+
+    //Wake up early enough for the fix to be ready when it is due
+    uint32_t lead = (uint32_t)(_ttff[_start] * 1000) + settleTime[_accuracy];
+    _nextFix += _interval;
+    if ((int32_t)(_nextFix - now) < 0) {
+        _nextFix = now;
+    }
+    _wakeAt = (int32_t)(_nextFix - lead - now) > 0 ? _nextFix - lead : now;
+
+    //"gps get_ttff" is cleared once the GPS goes idle
+    _acsip.setMode(S7XG_GPS_MODE_IDLE);
+    _state = S7XG_GPS_SCHED_SLEEPING;
+    return _level == S7XG_GPS_SLEEP ? _acsip.gpsSleep() : _acsip.gpsDeepSleep();
+}
+
+bool AcsipGPSScheduler::run()
+{
+    uint32_t now = millis();
+
+    if (_state == S7XG_GPS_SCHED_SLEEPING) {
+        if ((int32_t)(now - _wakeAt) >= 0) {
+            if (wake(now) != S7XG_OK) {
+                //Try again on the next run
+                return false;
+            }
+        }
+        return false;
+    }
+
+    if (_state != S7XG_GPS_SCHED_ACQUIRING || now - _lastPoll < ACSIP_GPS_POLL_INTERVAL) {
+        return false;
+    }
+    _lastPoll = now;
+
+    GPSDataStruct data;
+    if (_acsip.getData(data) != S7XG_OK || !data.isValid) {
+        if (now - _acquireStart > ACSIP_GPS_ACQUIRE_TIMEOUT) {
+            _failures++;
+            //Lost the sky, the next start has to search from scratch
+            _hasFix = false;
+            sleep();
+        }
+        return false;
+    }
+
+    if (!_fixed) {
+        _fixed = true;
+        _firstFix = now;
+        float ttff;
+        if (_acsip.getTtff(ttff) == S7XG_OK) {
+            learn(_start, ttff);
+        }
+    }
+    if (now - _firstFix < settleTime[_accuracy]) {
+        return false;
+    }
+
+    _fixes++;
+    _hasFix = true;
+    _lastFix = now;
+    if (_cb) {
+        _cb(data, _ttff[_start]);
+    }
+    sleep();
+    return true;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * GPS duty cycling.
+ *
+ * Between two fixes the Sony GPS is parked in sleep (level 0, keeps its
+ * RAM so the next start is hot) or deep sleep (level 1, lower current but
+ * the next start is warm). For every fix the scheduler compares the
+ * estimated charge of both options over the fix interval and picks the
+ * cheaper one, waking the GPS early by the expected TTFF so the fix is
+ * ready on time. TTFF per start mode is learned from "gps get_ttff".
+ *
+ * Call run() from loop(), the GPS must not be used by anything else.
+ */
+
+// Currents in mA, typical for a S76G. Measure your board and use setCurrent()
+#define ACSIP_GPS_ACQUIRE_MA            12.0f
+#define ACSIP_GPS_SLEEP_MA              0.75f
+#define ACSIP_GPS_DEEP_SLEEP_MA         0.03f
+
+// Initial TTFF guess in seconds until the first measurement
+#define ACSIP_GPS_TTFF_HOT              3.0f
+#define ACSIP_GPS_TTFF_WARM             30.0f
+#define ACSIP_GPS_TTFF_COLD             40.0f
+
+// Ephemeris age after which a hot start is no longer possible
+#define ACSIP_GPS_EPHEMERIS_AGE         (4UL * 3600UL * 1000UL)
+// Give up a fix attempt after this long
+#define ACSIP_GPS_ACQUIRE_TIMEOUT       (180UL * 1000UL)
+#define ACSIP_GPS_POLL_INTERVAL         1000
+
+enum GPSAccuracy {
+    S7XG_GPS_ACCURACY_LOW,          // first fix is good enough
+    S7XG_GPS_ACCURACY_MEDIUM,       // keep tracking 5s after the first fix
+    S7XG_GPS_ACCURACY_HIGH,         // keep tracking 20s after the first fix
+    S7XG_GPS_ACCURACY_MAX,
+};
+
+enum GPSSleepLevel {
+    S7XG_GPS_SLEEP,
+    S7XG_GPS_DEEP_SLEEP,
+};
+
+enum GPSSchedulerState {
+    S7XG_GPS_SCHED_STOPPED,
+    S7XG_GPS_SCHED_SLEEPING,
+    S7XG_GPS_SCHED_ACQUIRING,
+};
+
+typedef void (*gps_fix_callback)(const GPSDataStruct &fix, float ttff);
+
+class AcsipGPSScheduler
+{
+public:
+    AcsipGPSScheduler(Acsip &acsip);
+
+    /**
+     * @brief  begin
+     * @note   Starts the first fix right away.
+     * @param  interval: ms between fixes
+     * @param  accuracy: extra tracking time after the first fix
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int begin(uint32_t interval, GPSAccuracy accuracy = S7XG_GPS_ACCURACY_LOW);
+    void end();
+
+    void setCurrent(float acquireMa, float sleepMa, float deepSleepMa);
+    void setCallback(gps_fix_callback cb);
+
+    // Drive the state machine, returns true when a new fix was taken
+    bool run();
+
+    GPSSchedulerState getState();
+    GPSSleepLevel getSleepLevel();
+
+    // Learned TTFF in seconds for a start mode
+    float getTtff(GPSStartMode mode);
+
+    // Estimated charge of one fix cycle in uAh, for the given sleep level
+    float estimate(GPSSleepLevel level);
+
+    // Estimated charge of one fix cycle in uAh, for the chosen sleep level
+    float getEnergyPerFix();
+
+    uint32_t getFixes();
+    uint32_t getFailures();
+
+private:
+    GPSStartMode startMode(GPSSleepLevel level, uint32_t now);
+    int wake(uint32_t now);
+    int sleep();
+    void learn(GPSStartMode mode, float ttff);
+
+    Acsip              &_acsip;
+    GPSSchedulerState   _state;
+    GPSAccuracy         _accuracy;
+    GPSSleepLevel       _level;
+    GPSStartMode        _start;
+    gps_fix_callback    _cb;
+    uint32_t            _interval;
+    uint32_t            _nextFix;       // millis() the next fix is due
+    uint32_t            _wakeAt;
+    uint32_t            _acquireStart;
+    uint32_t            _firstFix;
+    uint32_t            _lastPoll;
+    uint32_t            _lastFix;
+    bool                _hasFix;
+    bool                _fixed;
+    float               _ttff[S7XG_GPS_START_MAX];
+    float               _acquireMa;
+    float               _sleepMa;
+    float               _deepSleepMa;
+    uint32_t            _fixes;
+    uint32_t            _failures;
+};
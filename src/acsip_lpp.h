@@ -0,0 +1,198 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Cayenne LPP encoder.
+ *
+ * Fields are written straight into the frame that send() hex-encodes onto
+ * the UART, there is no intermediate copy. The frame capacity is a
+ * template argument, AcsipLppFor<band, dr> sizes it to the LoRaWAN
+ * maximum payload of a data rate and fails to compile for a data rate the
+ * band does not have. A fixed layout can be checked at compile time:
+ *
+ *      static_assert(acsipLppSize(ACSIP_LPP_TEMPERATURE, ACSIP_LPP_BAROMETER)
+ *                    <= acsipMaxPayload(868, 0), "uplink too long for DR0");
+ *
+ * Each field is [channel] [type] [big endian value].
+ */
+
+enum AcsipLppType {
+    ACSIP_LPP_DIGITAL_INPUT     = 0,        // 1 byte
+    ACSIP_LPP_DIGITAL_OUTPUT    = 1,        // 1 byte
+    ACSIP_LPP_ANALOG_INPUT      = 2,        // 2 bytes, 0.01 signed
+    ACSIP_LPP_ANALOG_OUTPUT     = 3,        // 2 bytes, 0.01 signed
+    ACSIP_LPP_LUMINOSITY        = 101,      // 2 bytes, 1 lux unsigned
+    ACSIP_LPP_PRESENCE          = 102,      // 1 byte
+    ACSIP_LPP_TEMPERATURE       = 103,      // 2 bytes, 0.1 C signed
+    ACSIP_LPP_RELATIVE_HUMIDITY = 104,      // 1 byte, 0.5 % unsigned
+    ACSIP_LPP_ACCELEROMETER     = 113,      // 6 bytes, 0.001 G signed per axis
+    ACSIP_LPP_BAROMETER         = 115,      // 2 bytes, 0.1 hPa unsigned
+    ACSIP_LPP_GYROMETER         = 134,      // 6 bytes, 0.01 deg/s signed per axis
+    ACSIP_LPP_GPS               = 136,      // 9 bytes, 0.0001 deg lat/lng, 0.01 m alt
+};
+
+// Value bytes of a field type, 0 for unknown types
+constexpr uint8_t acsipLppDataSize(AcsipLppType type)
+{
+    return (type == ACSIP_LPP_DIGITAL_INPUT || type == ACSIP_LPP_DIGITAL_OUTPUT ||
+            type == ACSIP_LPP_PRESENCE || type == ACSIP_LPP_RELATIVE_HUMIDITY) ? 1 :
+           (type == ACSIP_LPP_ANALOG_INPUT || type == ACSIP_LPP_ANALOG_OUTPUT ||
+            type == ACSIP_LPP_LUMINOSITY || type == ACSIP_LPP_TEMPERATURE ||
+            type == ACSIP_LPP_BAROMETER) ? 2 :
+           (type == ACSIP_LPP_ACCELEROMETER || type == ACSIP_LPP_GYROMETER) ? 6 :
+           type == ACSIP_LPP_GPS ? 9 : 0;
+}
+
+// Encoded size of a list of fields
+constexpr size_t acsipLppSize()
+{
+    return 0;
+}
+
+template <typename... Types>
+constexpr size_t acsipLppSize(AcsipLppType type, Types... rest)
+{
+    return 2 + acsipLppDataSize(type) + acsipLppSize(rest...);
+}
+
+/**
+ * @brief  acsipMaxPayload
+ * @note   LoRaWAN 1.0.2 regional parameters, application payload without
+ *         FOpts. AS923 assumes the uplink dwell time limit is off.
+ * @param  band: "mac get_band" answer, 470, 868, 915 or 923
+ * @param  dr: data rate
+ * @retval bytes, 0 if the band has no such data rate
+ */
+constexpr uint8_t acsipMaxPayload(int band, uint8_t dr)
+{
+    return band == 915 ? (dr == 0 ? 11 : dr == 1 ? 53 : dr == 2 ? 125 : dr <= 4 ? 242 : 0) :
+           band == 923 ? (dr <= 2 ? 51 : dr == 3 ? 115 : dr <= 7 ? 242 : 0) :
+           band == 470 ? (dr <= 2 ? 51 : dr == 3 ? 115 : dr <= 5 ? 242 : 0) :
+           band == 868 ? (dr <= 2 ? 51 : dr == 3 ? 115 : dr <= 7 ? 242 : 0) : 0;
+}
+
+template <size_t N>
+class AcsipLpp
+{
+    static_assert(N > 0, "no such data rate on this band");
+    static_assert(N <= 242, "larger than any LoRaWAN payload");
+
+public:
+    AcsipLpp() : _len(0) {}
+
+    void reset()
+    {
+        _len = 0;
+    }
+
+    // Each add returns false and leaves the frame unchanged if the field does not fit
+    bool addDigitalInput(uint8_t channel, uint8_t value)
+    {
+        return put(channel, ACSIP_LPP_DIGITAL_INPUT, value);
+    }
+    bool addDigitalOutput(uint8_t channel, uint8_t value)
+    {
+        return put(channel, ACSIP_LPP_DIGITAL_OUTPUT, value);
+    }
+    bool addAnalogInput(uint8_t channel, float value)
+    {
+        return put(channel, ACSIP_LPP_ANALOG_INPUT, scale(value, 100));
+    }
+    bool addAnalogOutput(uint8_t channel, float value)
+    {
+        return put(channel, ACSIP_LPP_ANALOG_OUTPUT, scale(value, 100));
+    }
+    bool addLuminosity(uint8_t channel, uint16_t lux)
+    {
+        return put(channel, ACSIP_LPP_LUMINOSITY, lux);
+    }
+    bool addPresence(uint8_t channel, uint8_t value)
+    {
+        return put(channel, ACSIP_LPP_PRESENCE, value);
+    }
+    bool addTemperature(uint8_t channel, float celsius)
+    {
+        return put(channel, ACSIP_LPP_TEMPERATURE, scale(celsius, 10));
+    }
+    bool addRelativeHumidity(uint8_t channel, float percent)
+    {
+        return put(channel, ACSIP_LPP_RELATIVE_HUMIDITY, scale(percent, 2));
+    }
+    bool addAccelerometer(uint8_t channel, float x, float y, float z)
+    {
+        return put(channel, ACSIP_LPP_ACCELEROMETER, scale(x, 1000), scale(y, 1000), scale(z, 1000));
+    }
+    bool addBarometricPressure(uint8_t channel, float hpa)
+    {
+        return put(channel, ACSIP_LPP_BAROMETER, scale(hpa, 10));
+    }
+    bool addGyrometer(uint8_t channel, float x, float y, float z)
+    {
+        return put(channel, ACSIP_LPP_GYROMETER, scale(x, 100), scale(y, 100), scale(z, 100));
+    }
+    bool addGPS(uint8_t channel, float lat, float lng, float alt)
+    {
+        return put(channel, ACSIP_LPP_GPS, scale(lat, 10000), scale(lng, 10000), scale(alt, 100));
+    }
+
+    uint8_t *data()
+    {
+        return _buf;
+    }
+    size_t size() const
+    {
+        return _len;
+    }
+    static constexpr size_t capacity()
+    {
+        return N;
+    }
+
+    // The frame as it is, use after the data rate dropped below the one it was sized for
+    bool fits(uint8_t maxPayload) const
+    {
+        return _len <= maxPayload;
+    }
+
+    // Hex-encoded from the frame, see Acsip::send
+    int send(Acsip &acsip, uint8_t port, uint8_t type = 1)
+    {
+        return acsip.send(port, _buf, _len, type);
+    }
+
+private:
+    static int32_t scale(float value, int32_t factor)
+    {
+        float v = value * factor;
+        return (int32_t)(v < 0 ? v - 0.5f : v + 0.5f);
+    }
+
+    //Values are split over the field bytes, one per axis for 3 axis types
+    bool put(uint8_t channel, AcsipLppType type, int32_t a, int32_t b = 0, int32_t c = 0)
+    {
+        uint8_t size = acsipLppDataSize(type);
+        if (_len + 2 + size > N) {
+            return false;
+        }
+        uint8_t *p = &_buf[_len];
+        *p++ = channel;
+        *p++ = type;
+        uint8_t width = (size == 6 || size == 9) ? size / 3 : size;
+        int32_t values[3] = {a, b, c};
+        for (uint8_t i = 0; i < size / width; i++) {
+            for (int8_t shift = (width - 1) * 8; shift >= 0; shift -= 8) {
+                *p++ = (values[i] >> shift) & 0xFF;
+            }
+        }
+        _len += 2 + size;
+        return true;
+    }
+
+    uint8_t     _buf[N];
+    size_t      _len;
+};
+
+// Frame sized for the maximum payload of a data rate, e.g. AcsipLppFor<868, 0>
+template <int Band, uint8_t DR>
+using AcsipLppFor = AcsipLpp<acsipMaxPayload(Band, DR)>;
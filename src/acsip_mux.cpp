@@ -0,0 +1,80 @@
+#include "acsip_mux.h"
+
+
+AcsipMux::AcsipMux() : _count(0), _next(0)
+{
+}
+
+bool AcsipMux::add(Acsip &acsip)
+{
+    if (_count >= ACSIP_MUX_MAX_MODULES) {
+        return false;
+    }
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_modules[i] == &acsip) {
+            return true;
+        }
+    }
+    _modules[_count++] = &acsip;
+    return true;
+}
+
+bool AcsipMux::remove(Acsip &acsip)
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_modules[i] == &acsip) {
+            memmove(&_modules[i], &_modules[i + 1], (_count - i - 1) * sizeof(_modules[0]));
+            _count--;
+            _next = _count ? _next % _count : 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t AcsipMux::count()
+{
+    return _count;
+}
+
+bool AcsipMux::pending()
+{
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_modules[i]->pending()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int AcsipMux::poll()
+{
+    int events = 0;
+    if (_count == 0) {
+        return 0;
+    }
+    for (uint8_t n = 0; n < _count; n++) {
+        events += _modules[(_next + n) % _count]->process(ACSIP_MUX_BUDGET);
+    }
+    _next = (_next + 1) % _count;
+    return events;
+}
+
+int AcsipMux::wait(uint32_t timeout)
+{
+    uint32_t start = millis();
+    do {
+        int events = poll();
+        if (events) {
+            return events;
+        }
+        bool ready = false;
+        for (uint8_t i = 0; i < _count && !ready; i++) {
+            ready = _modules[i]->readable();
+        }
+        if (!ready) {
+            yield();
+        }
+    } while (millis() - start < timeout);
+    return 0;
+}
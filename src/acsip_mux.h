@@ -0,0 +1,55 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Drives several modules from one loop. Every module owns its receive framer
+ * and command queue (Acsip::submit / Acsip::process); the multiplexer only
+ * decides who gets serviced next.
+ *
+ * Each pass starts one module further than the previous pass and reads at
+ * most ACSIP_MUX_BUDGET bytes per module, so a chatty module in continuous
+ * RX can not starve the others.
+ */
+
+#ifndef ACSIP_MUX_MAX_MODULES
+#define ACSIP_MUX_MAX_MODULES           8
+#endif
+
+#ifndef ACSIP_MUX_BUDGET
+#define ACSIP_MUX_BUDGET                64
+#endif
+
+class AcsipMux
+{
+public:
+    AcsipMux();
+
+    bool add(Acsip &acsip);
+    bool remove(Acsip &acsip);
+    uint8_t count();
+
+    /**
+     * @brief  poll
+     * @note   One fair pass over all modules, never blocks.
+     * @retval number of completed commands and dispatched frames
+     */
+    int poll();
+
+    /**
+     * @brief  wait
+     * @note   Sleep until any module has received data or a command is due,
+     *         then run one pass.
+     * @param  timeout: ms to wait at most
+     * @retval number of completed commands and dispatched frames
+     */
+    int wait(uint32_t timeout);
+
+    // true while any module has queued or running commands
+    bool pending();
+
+private:
+    Acsip          *_modules[ACSIP_MUX_MAX_MODULES];
+    uint8_t         _count;
+    uint8_t         _next;
+};
@@ -0,0 +1,262 @@
+#include "acsip_nmea.h"
+
+
+static uint8_t fromHex(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0;
+}
+
+static uint8_t twoDigits(const char *p)
+{
+    return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+//ddmm.mmmm or dddmm.mmmm to decimal degree
+static double toDegree(const char *term)
+{
+    double value = atof(term);
+    int deg = (int)(value / 100);
+    return deg + (value - deg * 100) / 60.0;
+}
+
+AcsipNmea::AcsipNmea() :
+    _callback(nullptr),
+    _acsip(nullptr),
+    _type(S7XG_RMC),
+    _known(false),
+    _inSentence(false),
+    _inChecksum(false),
+    _checksum(0),
+    _received(0),
+    _termIndex(0),
+    _termLen(0),
+    _sentences(0),
+    _errors(0)
+{
+    memset(&_fix, 0, sizeof(_fix));
+    memset(&_pending, 0, sizeof(_pending));
+}
+
+void AcsipNmea::setCallback(nmea_callback cb)
+{
+    _callback = cb;
+}
+
+void AcsipNmea::attach(Acsip &acsip)
+{
+    _acsip = &acsip;
+}
+
+void AcsipNmea::toGPSData(GPSDataStruct &data)
+{
+    data.dd.datetime = _fix.datetime;
+    data.dd.lat = _fix.lat;
+    data.dd.lng = _fix.lng;
+    data.isValid = _fix.isValid;
+    data.second = 0;
+    data.type = S7XG_GPS_DATA_DD;
+    data.timestamp = millis();
+}
+
+const GPSNmeaFix &AcsipNmea::getFix()
+{
+    return _fix;
+}
+
+uint32_t AcsipNmea::getSentences()
+{
+    return _sentences;
+}
+
+uint32_t AcsipNmea::getChecksumErrors()
+{
+    return _errors;
+}
+
+bool AcsipNmea::encode(Stream &stream)
+{
+    bool updated = false;
+    while (stream.available()) {
+        if (encode((char)stream.read())) {
+            updated = true;
+        }
+    }
+    return updated;
+}
+
+bool AcsipNmea::encode(char c)
+{
+    switch (c) {
+    case '$':
+        _inSentence = true;
+        _inChecksum = false;
+        _known = false;
+        _checksum = 0;
+        _termIndex = 0;
+        _termLen = 0;
+        _pending = _fix;
+        return false;
+    case ',':
+        if (!_inSentence || _inChecksum) break;
+        _checksum ^= c;
+        term();
+        _termIndex++;
+        _termLen = 0;
+        return false;
+    case '*':
+        if (!_inSentence || _inChecksum) break;
+        term();
+        _inChecksum = true;
+        _received = 0;
+        _termLen = 0;
+        return false;
+    case '\r':
+    case '\n':
+        _inSentence = false;
+        return false;
+    default:
+        break;
+    }
+
+    if (!_inSentence) {
+        return false;
+    }
+    if (_inChecksum) {
+        _received = (_received << 4) | fromHex(c);
+        if (++_termLen == 2) {
+            _inSentence = false;
+            if (_received != _checksum) {
+                _errors++;
+                return false;
+            }
+            return commit();
+        }
+        return false;
+    }
+    _checksum ^= c;
+    if (_termLen < ACSIP_NMEA_TERM_SIZE - 1) {
+        _term[_termLen++] = c;
+    }
+    return false;
+}
+
+void AcsipNmea::term()
+{
+    _term[_termLen] = '\0';
+
+    if (_termIndex == 0) {
+        //Talker is ignored, $GPRMC and $GNRMC are the same sentence
+        _known = false;
+        if (_termLen == 5) {
+            if (strcmp(_term + 2, "RMC") == 0) {
+                _type = S7XG_RMC;
+                _known = true;
+            } else if (strcmp(_term + 2, "GGA") == 0) {
+                _type = S7XG_CGA;
+                _known = true;
+            }
+        }
+        return;
+    }
+    if (!_known || _termLen == 0) {
+        return;
+    }
+
+    if (_type == S7XG_RMC) {
+        switch (_termIndex) {
+        case 1:     //hhmmss.ss
+            if (_termLen < 6) break;
+            _pending.datetime.hour = twoDigits(_term);
+            _pending.datetime.minute = twoDigits(_term + 2);
+            _pending.datetime.second = twoDigits(_term + 4);
+            break;
+        case 2:
+            _pending.isValid = (_term[0] == 'A');
+            break;
+        case 3:
+            _pending.lat = toDegree(_term);
+            break;
+        case 4:
+            if (_term[0] == 'S') _pending.lat = -_pending.lat;
+            break;
+        case 5:
+            _pending.lng = toDegree(_term);
+            break;
+        case 6:
+            if (_term[0] == 'W') _pending.lng = -_pending.lng;
+            break;
+        case 7:
+            _pending.speed = atof(_term);
+            break;
+        case 8:
+            _pending.course = atof(_term);
+            break;
+        case 9:     //ddmmyy
+            if (_termLen < 6) break;
+            _pending.datetime.day = twoDigits(_term);
+            _pending.datetime.month = twoDigits(_term + 2);
+            _pending.datetime.year = twoDigits(_term + 4);
+            _pending.datetime.year += _pending.datetime.year < 80 ? 2000 : 1900;
+            break;
+        default:
+            break;
+        }
+    } else {
+        switch (_termIndex) {
+        case 1:
+            if (_termLen < 6) break;
+            _pending.datetime.hour = twoDigits(_term);
+            _pending.datetime.minute = twoDigits(_term + 2);
+            _pending.datetime.second = twoDigits(_term + 4);
+            break;
+        case 2:
+            _pending.lat = toDegree(_term);
+            break;
+        case 3:
+            if (_term[0] == 'S') _pending.lat = -_pending.lat;
+            break;
+        case 4:
+            _pending.lng = toDegree(_term);
+            break;
+        case 5:
+            if (_term[0] == 'W') _pending.lng = -_pending.lng;
+            break;
+        case 6:
+            _pending.quality = atoi(_term);
+            _pending.isValid = _pending.quality != 0;
+            break;
+        case 7:
+            _pending.satellites = atoi(_term);
+            break;
+        case 8:
+            _pending.hdop = atof(_term);
+            break;
+        case 9:
+            _pending.altitude = atof(_term);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+bool AcsipNmea::commit()
+{
+    if (!_known) {
+        return false;
+    }
+    _fix = _pending;
+    _sentences++;
+    if (_acsip && _fix.isValid) {
+        GPSDataStruct data;
+        toGPSData(data);
+        _acsip->updateGPS(data);
+    }
+    if (_callback) {
+        _callback(_fix, _type);
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Streaming NMEA0183 parser for the GPS UART routed out by
+ * "gps set_level_shift on" / "gps set_nmea rmc".
+ *
+ * Bytes are fed one at a time, only the current field is buffered and
+ * nothing is allocated. RMC and GGA sentences (any talker, GP/GN/...) are
+ * decoded; a sentence is only published after its checksum matches.
+ */
+
+#define ACSIP_NMEA_TERM_SIZE            16
+
+struct GPSNmeaFix {
+    struct GPSDateTime datetime;
+    double  lat;            // decimal degree, south is negative
+    double  lng;            // decimal degree, west is negative
+    float   speed;          // knots
+    float   course;         // degree
+    float   altitude;       // m, from GGA
+    float   hdop;           // from GGA
+    uint8_t satellites;     // from GGA
+    uint8_t quality;        // GGA fix quality, 0 is no fix
+    bool    isValid;        // RMC status 'A' or GGA quality != 0
+};
+
+typedef void (*nmea_callback)(const GPSNmeaFix &fix, GPSSentence type);
+
+class AcsipNmea
+{
+public:
+    AcsipNmea();
+
+    /**
+     * @brief  encode
+     * @param  c: next byte of the NMEA stream
+     * @retval true when a RMC or GGA sentence passed the checksum and
+     *         the fix has been updated
+     */
+    bool encode(char c);
+
+    // Feed everything available on a stream, returns true if the fix changed
+    bool encode(Stream &stream);
+
+    void setCallback(nmea_callback cb);
+
+    // Push every valid fix into acsip.GPSData, see Acsip::getFixAge
+    void attach(Acsip &acsip);
+
+    // Convert the current fix to the DD layout used by Acsip::getData
+    void toGPSData(GPSDataStruct &data);
+
+    const GPSNmeaFix &getFix();
+    uint32_t getSentences();
+    uint32_t getChecksumErrors();
+
+private:
+    void term();
+    bool commit();
+
+    nmea_callback   _callback;
+    Acsip          *_acsip;
+    GPSNmeaFix      _fix;
+    GPSNmeaFix      _pending;
+    GPSSentence     _type;
+    bool            _known;
+    bool            _inSentence;
+    bool            _inChecksum;
+    uint8_t         _checksum;
+    uint8_t         _received;
+    uint8_t         _termIndex;
+    uint8_t         _termLen;
+    char            _term[ACSIP_NMEA_TERM_SIZE];
+    uint32_t        _sentences;
+    uint32_t        _errors;
+};
@@ -0,0 +1,169 @@
+#include "acsip_recovery.h"
+
+AcsipRecovery::AcsipRecovery(Acsip &acsip) :
+    _acsip(acsip),
+    _configure(NULL),
+    _configureArg(NULL),
+    _rejoin(NULL),
+    _rejoinArg(NULL),
+    _hardReset(NULL),
+    _hardResetArg(NULL)
+{
+    resetStats();
+}
+
+void AcsipRecovery::setConfigure(recovery_callback cb, void *arg)
+{
+    _configure = cb;
+    _configureArg = arg;
+}
+
+void AcsipRecovery::setRejoin(recovery_callback cb, void *arg)
+{
+    _rejoin = cb;
+    _rejoinArg = arg;
+}
+
+void AcsipRecovery::setHardReset(recovery_callback cb, void *arg)
+{
+    _hardReset = cb;
+    _hardResetArg = arg;
+}
+
+const AcsipRecoveryStats &AcsipRecovery::getStats()
+{
+    return _stats;
+}
+
+void AcsipRecovery::resetStats()
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+AcsipFailure AcsipRecovery::classify(int err)
+{
+    switch (err) {
+    case S7XG_OK:
+    case S7XG_QUEUE_FULL:
+        //A full host queue never reached the module
+        return ACSIP_FAILURE_NONE;
+    case S7XG_BUSY:
+        return ACSIP_FAILURE_BUSY;
+    case S7XG_TIMEROUT:
+    case S7XG_FAILED:
+    case S7XG_UNKONW:
+        break;
+    default:
+        //A proper answer from the module, the link itself is fine
+        return ACSIP_FAILURE_NONE;
+    }
+
+    switch (_acsip.ping()) {
+    case S7XG_OK:
+        //It answers now, so the failed reply was lost or out of step
+        return err == S7XG_FAILED ? ACSIP_FAILURE_NONE : ACSIP_FAILURE_DESYNC;
+    case S7XG_FAILED:
+        return ACSIP_FAILURE_BAUD;
+    default:
+        return ACSIP_FAILURE_HUNG;
+    }
+}
+
+int AcsipRecovery::check(int err)
+{
+    AcsipFailure failure = classify(err);
+    if (failure == ACSIP_FAILURE_NONE) {
+        return err;
+    }
+    return recover(failure) == S7XG_OK ? S7XG_OK : err;
+}
+
+int AcsipRecovery::restore()
+{
+    if (_configure) {
+        int ret = _configure(_acsip, _configureArg);
+        if (ret != S7XG_OK) {
+            return ret;
+        }
+    }
+    if (_rejoin) {
+        return _rejoin(_acsip, _rejoinArg);
+    }
+    return S7XG_OK;
+}
+
+bool AcsipRecovery::step(AcsipRecoveryStep step)
+{
+    uint32_t baud;
+    switch (step) {
+    case ACSIP_RECOVERY_BACKOFF:
+        //Busy is transient, nothing is reset
+        for (uint8_t i = 0; i < ACSIP_RECOVERY_BUSY_RETRY; i++) {
+            delay(ACSIP_RECOVERY_BUSY_BACKOFF << i);
+            if (_acsip.ping() == S7XG_OK) {
+                return true;
+            }
+        }
+        return false;
+    case ACSIP_RECOVERY_RESYNC:
+        //ping drains the port and restarts the framer, try twice
+        return _acsip.ping() == S7XG_OK || _acsip.ping() == S7XG_OK;
+    case ACSIP_RECOVERY_BAUD:
+        return _acsip.autoBaud(baud) == S7XG_OK;
+    case ACSIP_RECOVERY_RESET:
+        //"sip reset" only works while the module still reads its UART
+        _acsip.reset();
+        delay(ACSIP_RECOVERY_RESET_WAIT);
+        if (_acsip.ping() != S7XG_OK && _acsip.autoBaud(baud) != S7XG_OK) {
+            return false;
+        }
+        return restore() == S7XG_OK;
+    case ACSIP_RECOVERY_HARD_RESET:
+        if (!_hardReset || _hardReset(_acsip, _hardResetArg) != S7XG_OK) {
+            return false;
+        }
+        delay(ACSIP_RECOVERY_RESET_WAIT);
+        if (_acsip.autoBaud(baud) != S7XG_OK) {
+            return false;
+        }
+        return restore() == S7XG_OK;
+    default:
+        return false;
+    }
+}
+
+int AcsipRecovery::recover(AcsipFailure failure)
+{
+    if (failure == ACSIP_FAILURE_NONE || failure >= ACSIP_FAILURE_MAX) {
+        return S7XG_OK;
+    }
+    _stats.failures[failure]++;
+    uint32_t start = millis();
+
+    //Only a busy module is worth waiting for. A resync can not fix a baud
+    //mismatch, and a module that ignores every byte may just be listening
+    //at another rate, which is cheaper to find than a reset and rejoin
+    AcsipRecoveryStep first = ACSIP_RECOVERY_RESYNC;
+    if (failure == ACSIP_FAILURE_BUSY) {
+        first = ACSIP_RECOVERY_BACKOFF;
+    } else if (failure == ACSIP_FAILURE_BAUD || failure == ACSIP_FAILURE_HUNG) {
+        first = ACSIP_RECOVERY_BAUD;
+    }
+
+    for (int s = first; s < ACSIP_RECOVERY_STEP_MAX; s++) {
+        if (step((AcsipRecoveryStep)s)) {
+            uint32_t elapsed = millis() - start;
+            _stats.steps[s]++;
+            _stats.recovered++;
+            _stats.lastTime = elapsed;
+            _stats.totalTime += elapsed;
+            if (elapsed > _stats.maxTime) {
+                _stats.maxTime = elapsed;
+            }
+            return S7XG_OK;
+        }
+    }
+    _stats.unrecovered++;
+    _stats.lastTime = millis() - start;
+    return S7XG_FAILED;
+}
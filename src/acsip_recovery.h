@@ -0,0 +1,105 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Link recovery.
+ *
+ * Pass the result of a failed call to check(). The failure is classified
+ * by pinging the module, then recovery escalates one step at a time until
+ * the module answers again:
+ *
+ *  BACKOFF     busy only, wait with a growing delay for the module to answer
+ *  RESYNC      drain the port and resync the reply framer
+ *  BAUD        detect the module baud rate again
+ *  RESET       "sip reset", then re-apply the configuration and rejoin
+ *  HARD_RESET  user callback (power cycle / RST pin), then configure and rejoin
+ *
+ * Every failure and the time until the link answered again are recorded.
+ */
+
+#define ACSIP_RECOVERY_BUSY_RETRY       3
+#define ACSIP_RECOVERY_BUSY_BACKOFF     1000
+#define ACSIP_RECOVERY_RESET_WAIT       2000
+
+enum AcsipFailure {
+    ACSIP_FAILURE_NONE,
+    ACSIP_FAILURE_DESYNC,           // module answers, the last reply was lost or garbled
+    ACSIP_FAILURE_BUSY,             // module reports busy
+    ACSIP_FAILURE_HUNG,             // nothing comes back
+    ACSIP_FAILURE_BAUD,             // bytes come back but never a valid frame
+    ACSIP_FAILURE_MAX,
+};
+
+enum AcsipRecoveryStep {
+    ACSIP_RECOVERY_BACKOFF,
+    ACSIP_RECOVERY_RESYNC,
+    ACSIP_RECOVERY_BAUD,
+    ACSIP_RECOVERY_RESET,
+    ACSIP_RECOVERY_HARD_RESET,
+    ACSIP_RECOVERY_STEP_MAX,
+};
+
+struct AcsipRecoveryStats {
+    uint32_t failures[ACSIP_FAILURE_MAX];       // by class
+    uint32_t steps[ACSIP_RECOVERY_STEP_MAX];    // recoveries by the step that fixed them
+    uint32_t recovered;
+    uint32_t unrecovered;
+    uint32_t lastTime;                          // ms, last time to recover
+    uint32_t maxTime;
+    uint32_t totalTime;
+
+    uint32_t meanTime() const
+    {
+        return recovered ? totalTime / recovered : 0;
+    }
+};
+
+// Return S7XG_OK on success
+typedef int (*recovery_callback)(Acsip &acsip, void *arg);
+
+class AcsipRecovery
+{
+public:
+    AcsipRecovery(Acsip &acsip);
+
+    // Re-apply the configuration after a reset (channels, data rate, GPS ...)
+    void setConfigure(recovery_callback cb, void *arg = NULL);
+
+    // Rejoin after a reset, e.g. AcsipSession::begin
+    void setRejoin(recovery_callback cb, void *arg = NULL);
+
+    // Last resort, power cycle the module or pulse its reset pin
+    void setHardReset(recovery_callback cb, void *arg = NULL);
+
+    /**
+     * @brief  check
+     * @param  err: result of an Acsip call
+     * @retval S7XG_OK if the link works, recovered if needed, else the
+     *         original error. Errors the module reported properly (Invalid,
+     *         unjoined ...) are returned unchanged without recovery.
+     */
+    int check(int err);
+
+    // Classify a failed call, pings the module for the timeout class errors
+    AcsipFailure classify(int err);
+
+    // Run the escalation for a failure, returns S7XG_OK once the module answers
+    int recover(AcsipFailure failure);
+
+    const AcsipRecoveryStats &getStats();
+    void resetStats();
+
+private:
+    bool step(AcsipRecoveryStep step);
+    int restore();
+
+    Acsip              &_acsip;
+    recovery_callback   _configure;
+    void               *_configureArg;
+    recovery_callback   _rejoin;
+    void               *_rejoinArg;
+    recovery_callback   _hardReset;
+    void               *_hardResetArg;
+    AcsipRecoveryStats  _stats;
+};
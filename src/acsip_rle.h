@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Palette + run length compressed RGB565 image, see acsiplogo.h.
+ *
+ * Every pixel run is coded against a palette of at most 128 colors:
+ *
+ *  1iiiiiii            one pixel of palette color i
+ *  0iiiiiii nnnnnnnn   n + 2 pixels of palette color i
+ *
+ * AcsipRleDecoder expands the stream into a caller buffer of any size, a
+ * scanline is enough to push the image to a display:
+ *
+ *      uint16_t line[ACSIPLOGO_WIDTH];
+ *      AcsipRleDecoder logo(acsiplogo);
+ *      tft->setAddrWindow(30, 25, ACSIPLOGO_WIDTH, ACSIPLOGO_HEIGHT);
+ *      while (logo.read(line, ACSIPLOGO_WIDTH)) {
+ *          tft->pushColors(line, ACSIPLOGO_WIDTH);
+ *      }
+ */
+
+struct AcsipRleImage {
+    uint16_t        width;
+    uint16_t        height;
+    const uint16_t *palette;
+    const uint8_t  *data;
+    size_t          size;
+};
+
+class AcsipRleDecoder
+{
+public:
+    AcsipRleDecoder(const AcsipRleImage &image) : _image(image)
+    {
+        rewind();
+    }
+
+    void rewind()
+    {
+        _pos = 0;
+        _left = 0;
+        _color = 0;
+        _pixels = (uint32_t)_image.width * _image.height;
+    }
+
+    /**
+     * @brief  read
+     * @param  dst: destination for the next pixels
+     * @param  count: pixels wanted
+     * @retval pixels written, 0 at the end of the image
+     */
+    size_t read(uint16_t *dst, size_t count)
+    {
+        size_t n = 0;
+        while (n < count && _pixels) {
+            if (_left == 0) {
+                if (_pos >= _image.size) {
+                    //Data ends early, pad with the first palette color
+                    _color = _image.palette[0];
+                    _left = _pixels;
+                } else {
+                    uint8_t b = _image.data[_pos++];
+                    _color = _image.palette[b & 0x7F];
+                    if (b & 0x80) {
+                        _left = 1;
+                    } else {
+                        _left = (_pos < _image.size ? _image.data[_pos++] : 0) + 2;
+                    }
+                }
+            }
+            size_t run = _left;
+            if (run > count - n) run = count - n;
+            if (run > _pixels) run = _pixels;
+            for (size_t i = 0; i < run; i++) {
+                dst[n++] = _color;
+            }
+            _left -= run;
+            _pixels -= run;
+        }
+        return n;
+    }
+
+private:
+    const AcsipRleImage &_image;
+    size_t      _pos;
+    uint32_t    _left;
+    uint32_t    _pixels;
+    uint16_t    _color;
+};
@@ -0,0 +1,161 @@
+#include "acsip_session.h"
+
+AcsipSession::AcsipSession(Acsip &acsip) :
+    _acsip(acsip),
+    _load(NULL),
+    _store(NULL),
+    _arg(NULL),
+    _restored(false)
+{
+    memset(&_data, 0, sizeof(_data));
+}
+
+void AcsipSession::setStorage(session_load load, session_store store, void *arg)
+{
+    _load = load;
+    _store = store;
+    _arg = arg;
+}
+
+bool AcsipSession::restored()
+{
+    return _restored;
+}
+
+bool AcsipSession::isHex(const char *str, size_t len)
+{
+    if (strlen(str) != len) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (!isxdigit(str[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int AcsipSession::store(uint32_t upCount)
+{
+    if (!_store) {
+        return S7XG_FAILED;
+    }
+    _data.magic = ACSIP_SESSION_MAGIC;
+    _data.upCount = upCount;
+    _data.crc = Acsip::crc32(&_data, offsetof(AcsipSessionData, crc));
+    return _store(&_data, sizeof(_data), _arg) ? S7XG_OK : S7XG_FAILED;
+}
+
+int AcsipSession::save()
+{
+    uint32_t up, down;
+    int ret;
+
+    if (!_acsip.isJoin()) {
+        return S7XG_UNJOINED;
+    }
+    ret = _acsip.getDevAddr(_data.devAddr, sizeof(_data.devAddr));
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.getNetworkSessionKey(_data.nwkSKey, sizeof(_data.nwkSKey));
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.getAppSessionKey(_data.appSKey, sizeof(_data.appSKey));
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.getUplinkCounter(up);
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.getDownLinkCounter(down);
+    if (ret != S7XG_OK) return ret;
+
+    if (!isHex(_data.devAddr, sizeof(_data.devAddr) - 1) ||
+            !isHex(_data.nwkSKey, sizeof(_data.nwkSKey) - 1) ||
+            !isHex(_data.appSKey, sizeof(_data.appSKey) - 1)) {
+        return S7XG_INVALD;
+    }
+    _data.downCount = down;
+    return store(up + ACSIP_SESSION_FCNT_GAP);
+}
+
+int AcsipSession::restore()
+{
+    int ret;
+
+    _restored = false;
+    if (!_load || !_load(&_data, sizeof(_data), _arg)) {
+        memset(&_data, 0, sizeof(_data));
+        return S7XG_FAILED;
+    }
+    if (_data.magic != ACSIP_SESSION_MAGIC ||
+            _data.crc != Acsip::crc32(&_data, offsetof(AcsipSessionData, crc))) {
+        memset(&_data, 0, sizeof(_data));
+        return S7XG_FAILED;
+    }
+
+    //Counters below the reservation may have been used before the reset
+    uint32_t up = _data.upCount;
+    if (up > UINT32_MAX - ACSIP_SESSION_FCNT_GAP) {
+        //Counter space exhausted, the session must be renewed by OTAA
+        return S7XG_FAILED;
+    }
+    //Reserve before the first uplink so a crash can not reuse 'up'
+    ret = store(up + ACSIP_SESSION_FCNT_GAP);
+    if (ret != S7XG_OK) return ret;
+
+    ret = _acsip.setABPKeys(_data.devAddr, _data.appSKey, _data.nwkSKey);
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.joinABP();
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.setUplinkCounter(up);
+    if (ret != S7XG_OK) return ret;
+    ret = _acsip.setDownLinkCounter(_data.downCount);
+    if (ret != S7XG_OK) return ret;
+
+    _restored = true;
+    return S7XG_OK;
+}
+
+int AcsipSession::update()
+{
+    uint32_t up, down;
+    //Nothing saved or restored yet, do not store empty keys as a session
+    if (_data.magic != ACSIP_SESSION_MAGIC) {
+        return S7XG_UNJOINED;
+    }
+    int ret = _acsip.getUplinkCounter(up);
+    if (ret != S7XG_OK) return ret;
+    if (up + ACSIP_SESSION_FCNT_GAP / 4 < _data.upCount) {
+        return S7XG_OK;
+    }
+    ret = _acsip.getDownLinkCounter(down);
+    if (ret != S7XG_OK) return ret;
+    _data.downCount = down;
+    return store(up + ACSIP_SESSION_FCNT_GAP);
+}
+
+int AcsipSession::clear()
+{
+    memset(&_data, 0, sizeof(_data));
+    _restored = false;
+    if (!_store) {
+        return S7XG_FAILED;
+    }
+    return _store(&_data, sizeof(_data), _arg) ? S7XG_OK : S7XG_FAILED;
+}
+
+int AcsipSession::begin(uint32_t timeout)
+{
+    if (restore() == S7XG_OK) {
+        return S7XG_OK;
+    }
+
+    int ret = _acsip.joinOTAA();
+    if (ret != S7XG_OK) {
+        return ret;
+    }
+    uint32_t start = millis();
+    while (!_acsip.isJoin()) {
+        if (millis() - start > timeout) {
+            return S7XG_TIMEROUT;
+        }
+        delay(1000);
+    }
+    return save();
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * LoRaWAN session persistence.
+ *
+ * After an OTAA join the session (DevAddr, NwkSKey, AppSKey and the frame
+ * counters) is read back from the module and handed to a user supplied
+ * store. On the next cold boot it is written back with "mac set_keys" and
+ * the module joins in ABP mode, without any airtime.
+ *
+ * The stored uplink counter is a reservation: restore continues from it and
+ * immediately reserves the next ACSIP_SESSION_FCNT_GAP frames, so a reset
+ * between two saves can never reuse a counter the network has seen. Call
+ * update() after uplinks, it only writes the store when the reservation is
+ * used up.
+ */
+
+// Uplinks reserved per write of the store
+#ifndef ACSIP_SESSION_FCNT_GAP
+#define ACSIP_SESSION_FCNT_GAP          64
+#endif
+
+#define ACSIP_SESSION_MAGIC             0x53455331UL    // "SES1"
+
+struct AcsipSessionData {
+    uint32_t magic;
+    char     devAddr[ACSIP_DEVADDR_SIZE];
+    char     nwkSKey[ACSIP_KEY_SIZE];
+    char     appSKey[ACSIP_KEY_SIZE];
+    uint32_t upCount;           // first uplink counter not yet reserved
+    uint32_t downCount;
+    uint32_t crc;               // CRC-32 of everything above
+};
+
+// Return true on success, 'len' is always sizeof(AcsipSessionData)
+typedef bool (*session_load)(void *data, size_t len, void *arg);
+typedef bool (*session_store)(const void *data, size_t len, void *arg);
+
+class AcsipSession
+{
+public:
+    AcsipSession(Acsip &acsip);
+
+    /**
+     * @brief  setStorage
+     * @note   Any non volatile place works: ESP32 Preferences, EEPROM or a
+     *         file. RTC memory only survives deep sleep, not a power cycle.
+     */
+    void setStorage(session_load load, session_store store, void *arg = NULL);
+
+    /**
+     * @brief  begin
+     * @note   Restore the stored session, or join with OTAA and save the new
+     *         one. The module must be configured for OTAA beforehand.
+     * @param  timeout: ms to wait for the OTAA join
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int begin(uint32_t timeout = 60000);
+
+    // Read the current session from the joined module and store it
+    int save();
+
+    // Write the stored session to the module and join ABP
+    int restore();
+
+    // Extend the counter reservation when it runs out, call after uplinks.
+    // S7XG_UNJOINED until a session was saved or restored
+    int update();
+
+    // Forget the stored session, the next begin joins with OTAA
+    int clear();
+
+    bool restored();
+
+private:
+    int store(uint32_t upCount);
+    static bool isHex(const char *str, size_t len);
+
+    Acsip              &_acsip;
+    session_load        _load;
+    session_store       _store;
+    void               *_arg;
+    AcsipSessionData    _data;
+    bool                _restored;
+};
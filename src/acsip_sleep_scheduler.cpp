@@ -0,0 +1,166 @@
+#include "acsip_sleep_scheduler.h"
+
+//Deadlines are compared as signed distances, millis() may wrap
+static inline int32_t until(uint32_t deadline, uint32_t now)
+{
+    return (int32_t)(deadline - now);
+}
+
+AcsipSleepScheduler::AcsipSleepScheduler(Acsip &acsip) :
+    _acsip(acsip),
+    _guard(ACSIP_SLEEP_WAKE_GUARD),
+    _sleeping(false),
+    _wakeAt(0),
+    _wakes(0),
+    _runs(0),
+    _coalesced(0),
+    _slept(0)
+{
+    memset(_tasks, 0, sizeof(_tasks));
+}
+
+int AcsipSleepScheduler::add(sleep_task_callback cb, void *arg, uint32_t period, uint32_t window)
+{
+    for (int i = 0; i < ACSIP_SLEEP_TASKS; i++) {
+        if (_tasks[i].cb == NULL) {
+            Task &t = _tasks[i];
+            t.cb = cb;
+            t.arg = arg;
+            t.period = period;
+            t.window = window;
+            t.next = millis() + period;
+            t.armed = period != 0;
+            return i;
+        }
+    }
+    return -1;
+}
+
+void AcsipSleepScheduler::remove(int id)
+{
+    if (id >= 0 && id < ACSIP_SLEEP_TASKS) {
+        memset(&_tasks[id], 0, sizeof(_tasks[id]));
+    }
+}
+
+void AcsipSleepScheduler::schedule(int id, uint32_t delay)
+{
+    if (id >= 0 && id < ACSIP_SLEEP_TASKS && _tasks[id].cb) {
+        _tasks[id].next = millis() + delay;
+        _tasks[id].armed = true;
+    }
+}
+
+void AcsipSleepScheduler::setWakeGuard(uint32_t ms)
+{
+    _guard = ms;
+}
+
+bool AcsipSleepScheduler::isSleeping()
+{
+    return _sleeping;
+}
+
+uint32_t AcsipSleepScheduler::getWakes()
+{
+    return _wakes;
+}
+
+uint32_t AcsipSleepScheduler::getRuns()
+{
+    return _runs;
+}
+
+uint32_t AcsipSleepScheduler::getCoalesced()
+{
+    return _coalesced;
+}
+
+uint32_t AcsipSleepScheduler::getSleepTime()
+{
+    return _slept;
+}
+
+//ms until the first armed deadline, 0 if one is overdue
+bool AcsipSleepScheduler::earliest(uint32_t now, uint32_t &ms)
+{
+    bool found = false;
+    int32_t best = 0;
+    for (int i = 0; i < ACSIP_SLEEP_TASKS; i++) {
+        if (_tasks[i].cb && _tasks[i].armed) {
+            int32_t d = until(_tasks[i].next, now);
+            if (!found || d < best) {
+                best = d;
+                found = true;
+            }
+        }
+    }
+    ms = best > 0 ? best : 0;
+    return found;
+}
+
+uint32_t AcsipSleepScheduler::run()
+{
+    uint32_t now = millis();
+    uint32_t due;
+    bool pending = earliest(now, due);
+
+    if (_sleeping) {
+        //Woken by its timer, or early when a deadline moved inside the guard
+        int32_t left = until(_wakeAt, now);
+        if (left > 0 && (!pending || due > _guard)) {
+            uint32_t wake = pending ? due - _guard : left;
+            return wake < (uint32_t)left ? wake : left;
+        }
+        _acsip.wakeup();
+        _sleeping = false;
+        _wakes++;
+        now = millis();
+        pending = earliest(now, due);
+    }
+
+    if (pending && due == 0) {
+        //Everything within its window of now shares this wake
+        for (int i = 0; i < ACSIP_SLEEP_TASKS; i++) {
+            Task &t = _tasks[i];
+            if (!t.cb || !t.armed || until(t.next, now) > (int32_t)t.window) {
+                continue;
+            }
+            bool early = until(t.next, now) > 0;
+            if (early) {
+                _coalesced++;
+            }
+            if (t.period) {
+                t.next += t.period;
+                //Ran early or fell behind, count the period from this run
+                if (early || until(t.next, now) <= 0) {
+                    t.next = now + t.period;
+                }
+            } else {
+                t.armed = false;
+            }
+            _runs++;
+            t.cb(_acsip, t.arg);
+        }
+        now = millis();
+        pending = earliest(now, due);
+    }
+
+    if (!pending) {
+        return 0;
+    }
+    if (due > _guard) {
+        uint32_t second = (due - _guard) / 1000;
+        second -= second % ACSIP_SLEEP_STEP;
+        if (second > ACSIP_SLEEP_MAX) {
+            second = ACSIP_SLEEP_MAX;
+        }
+        if (second >= ACSIP_SLEEP_STEP && _acsip.sleep(second, true) == S7XG_OK) {
+            _sleeping = true;
+            _wakeAt = millis() + second * 1000;
+            _slept += second;
+            return second * 1000;
+        }
+    }
+    return due;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Wake coalescing for "sip sleep".
+ *
+ * Periodic and one-shot tasks (uplink, GPS fix, battery sample ...) are
+ * registered with their deadline. Whenever one task is due, every task
+ * whose deadline falls within its own window runs in the same wake. The
+ * module is then put into the longest "sip sleep" that ends before the
+ * next deadline: a multiple of 10 seconds, up to 7 days, leaving the wake
+ * guard for the module to come up. If a deadline moves earlier while the
+ * module sleeps, it is woken over UART.
+ *
+ * Call run() from loop(). While the module sleeps nothing else may talk to
+ * it, the first command would be lost waking it up. "sip sleep" also puts
+ * the GPS to sleep, tasks that need a fix have to start it again.
+ */
+
+#ifndef ACSIP_SLEEP_TASKS
+#define ACSIP_SLEEP_TASKS               8
+#endif
+
+// "sip sleep" granularity and range in seconds
+#define ACSIP_SLEEP_STEP                10
+#define ACSIP_SLEEP_MAX                 604800UL
+
+// ms the module is woken ahead of a deadline
+#define ACSIP_SLEEP_WAKE_GUARD          1000
+
+typedef void (*sleep_task_callback)(Acsip &acsip, void *arg);
+
+class AcsipSleepScheduler
+{
+public:
+    AcsipSleepScheduler(Acsip &acsip);
+
+    /**
+     * @brief  add
+     * @param  cb: task, the module is awake when it runs
+     * @param  arg: passed back to cb
+     * @param  period: ms between runs, 0 for a one-shot task armed by schedule()
+     * @param  window: ms the task may run early to share a wake with another
+     * @retval task id, -1 if all ACSIP_SLEEP_TASKS slots are used
+     */
+    int add(sleep_task_callback cb, void *arg, uint32_t period, uint32_t window = 0);
+    void remove(int id);
+
+    // Next run of a task 'delay' ms from now, arms one-shot tasks
+    void schedule(int id, uint32_t delay);
+
+    void setWakeGuard(uint32_t ms);
+
+    /**
+     * @brief  run
+     * @note   Wakes the module when a deadline is near, runs the due tasks
+     *         and puts the module back to sleep if the next deadline allows.
+     * @retval ms until run() has work again, the host may sleep that long
+     */
+    uint32_t run();
+
+    bool isSleeping();
+
+    uint32_t getWakes();            // module wakes
+    uint32_t getRuns();             // task runs
+    uint32_t getCoalesced();        // task runs that shared another task's wake
+    uint32_t getSleepTime();        // seconds of "sip sleep" requested
+
+private:
+    struct Task {
+        sleep_task_callback cb;
+        void               *arg;
+        uint32_t            period;
+        uint32_t            window;
+        uint32_t            next;
+        bool                armed;
+    };
+
+    bool earliest(uint32_t now, uint32_t &ms);
+
+    Acsip      &_acsip;
+    Task        _tasks[ACSIP_SLEEP_TASKS];
+    uint32_t    _guard;
+    bool        _sleeping;
+    uint32_t    _wakeAt;
+    uint32_t    _wakes;
+    uint32_t    _runs;
+    uint32_t    _coalesced;
+    uint32_t    _slept;
+};
@@ -0,0 +1,201 @@
+#include "acsip_track.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include "acsip.h"
+#endif
+
+
+static inline uint32_t zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t v)
+{
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+static size_t putVarint(uint8_t *p, uint32_t v)
+{
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (v & 0x7F) | 0x80;
+        v >>= 7;
+    }
+    p[n++] = v;
+    return n;
+}
+
+static bool getVarint(const uint8_t *p, size_t len, size_t &pos, uint32_t &v)
+{
+    v = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+        if (pos >= len) {
+            return false;
+        }
+        uint8_t b = p[pos++];
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint32_t acsipTrackTime(uint16_t year, uint8_t month, uint8_t day,
+                        uint8_t hour, uint8_t minute, uint8_t second)
+{
+    //Days since 2000-01-01, the year starts in March to keep leap days last
+    int32_t y = year - (month <= 2);
+    int32_t era = y / 400;
+    int32_t yoe = y - era * 400;
+    int32_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    int32_t days = era * 146097 + doe - 730425;
+    if (days < 0) {
+        return 0;
+    }
+    return (uint32_t)days * 86400UL + hour * 3600UL + minute * 60UL + second;
+}
+
+/*****************************************
+ *          ENCODER
+ ****************************************/
+AcsipTrackEncoder::AcsipTrackEncoder(uint8_t *buffer, size_t size) :
+    _buffer(buffer),
+    _capacity(size)
+{
+    reset();
+}
+
+void AcsipTrackEncoder::reset()
+{
+    _size = 0;
+    _count = 0;
+    memset(&_last, 0, sizeof(_last));
+}
+
+bool AcsipTrackEncoder::add(const AcsipTrackPoint &point)
+{
+    if (_count == 0xFF) {
+        return false;
+    }
+    if (_count == 0) {
+        if (_capacity < ACSIP_TRACK_HEADER_SIZE) {
+            return false;
+        }
+        _buffer[0] = ACSIP_TRACK_VERSION;
+        put32(&_buffer[2], point.lat);
+        put32(&_buffer[6], point.lng);
+        put32(&_buffer[10], point.time);
+        _size = ACSIP_TRACK_HEADER_SIZE;
+    } else {
+        uint8_t tmp[ACSIP_TRACK_POINT_MAX];
+        size_t n = putVarint(tmp, zigzag(point.lat - _last.lat));
+        n += putVarint(tmp + n, zigzag(point.lng - _last.lng));
+        n += putVarint(tmp + n, zigzag((int32_t)(point.time - _last.time)));
+        if (_size + n > _capacity) {
+            return false;
+        }
+        memcpy(&_buffer[_size], tmp, n);
+        _size += n;
+    }
+    _last = point;
+    _buffer[1] = ++_count;
+    return true;
+}
+
+#ifdef ARDUINO
+bool AcsipTrackEncoder::add(const GPSDataStruct &fix)
+{
+    if (!fix.isValid) {
+        return false;
+    }
+    AcsipTrackPoint point;
+    double lat, lng;
+    Acsip::toDegrees(fix, lat, lng);
+    //datetime is the first member of every layout
+    const GPSDateTime *dt = &fix.dd.datetime;
+    point.lat = (int32_t)lround(lat * 1e6);
+    point.lng = (int32_t)lround(lng * 1e6);
+    point.time = acsipTrackTime(dt->year, dt->month, dt->day, dt->hour, dt->minute, dt->second);
+    return add(point);
+}
+#endif
+
+const uint8_t *AcsipTrackEncoder::data() const
+{
+    return _buffer;
+}
+
+size_t AcsipTrackEncoder::size() const
+{
+    return _size;
+}
+
+uint8_t AcsipTrackEncoder::count() const
+{
+    return _count;
+}
+
+/*****************************************
+ *          DECODER
+ ****************************************/
+AcsipTrackDecoder::AcsipTrackDecoder(const uint8_t *data, size_t len) :
+    _data(data),
+    _len(len),
+    _pos(0),
+    _read(0)
+{
+    memset(&_last, 0, sizeof(_last));
+}
+
+bool AcsipTrackDecoder::valid() const
+{
+    return _len >= ACSIP_TRACK_HEADER_SIZE && _data[0] == ACSIP_TRACK_VERSION;
+}
+
+uint8_t AcsipTrackDecoder::count() const
+{
+    return valid() ? _data[1] : 0;
+}
+
+bool AcsipTrackDecoder::next(AcsipTrackPoint &point)
+{
+    if (!valid() || _read >= _data[1]) {
+        return false;
+    }
+    if (_read == 0) {
+        _last.lat = (int32_t)get32(&_data[2]);
+        _last.lng = (int32_t)get32(&_data[6]);
+        _last.time = get32(&_data[10]);
+        _pos = ACSIP_TRACK_HEADER_SIZE;
+    } else {
+        uint32_t dlat, dlng, dt;
+        if (!getVarint(_data, _len, _pos, dlat) ||
+                !getVarint(_data, _len, _pos, dlng) ||
+                !getVarint(_data, _len, _pos, dt)) {
+            return false;
+        }
+        _last.lat += unzigzag(dlat);
+        _last.lng += unzigzag(dlng);
+        _last.time += unzigzag(dt);
+    }
+    _read++;
+    point = _last;
+    return true;
+}
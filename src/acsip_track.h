@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Compact GPS track uplink format.
+ *
+ *  [version] [count]
+ *  anchor : lat int32 LE, lng int32 LE (micro degree), time uint32 LE
+ *           (seconds since 2000-01-01 UTC)
+ *  point  : zig-zag varint delta of lat, lng and time against the
+ *           previous point
+ *
+ * A slow moving tracker needs 3 to 6 bytes per point after the 14 byte
+ * header, so 10-20 points fit into a single uplink.
+ *
+ * This file only depends on the C library so the decoder builds on a
+ * Linux server as well, see extras/track_decode.
+ */
+
+#define ACSIP_TRACK_VERSION             0x01
+#define ACSIP_TRACK_HEADER_SIZE         14
+// A zig-zag varint of a 32 bit value takes at most 5 bytes
+#define ACSIP_TRACK_POINT_MAX           15
+
+struct AcsipTrackPoint {
+    int32_t  lat;       // micro degree, south is negative
+    int32_t  lng;       // micro degree, west is negative
+    uint32_t time;      // seconds since 2000-01-01 UTC
+};
+
+uint32_t acsipTrackTime(uint16_t year, uint8_t month, uint8_t day,
+                        uint8_t hour, uint8_t minute, uint8_t second);
+
+class AcsipTrackEncoder
+{
+public:
+    AcsipTrackEncoder(uint8_t *buffer, size_t size);
+
+    void reset();
+
+    /**
+     * @brief  add
+     * @note   The first point becomes the anchor.
+     * @retval false if the point does not fit into the buffer, the
+     *         encoded data is left unchanged
+     */
+    bool add(const AcsipTrackPoint &point);
+
+#ifdef ARDUINO
+    // Fix from Acsip::getData or Acsip::GPSData, any data format
+    bool add(const struct GPSDataStruct &fix);
+#endif
+
+    const uint8_t *data() const;
+    size_t size() const;
+    uint8_t count() const;
+
+private:
+    uint8_t        *_buffer;
+    size_t          _capacity;
+    size_t          _size;
+    uint8_t         _count;
+    AcsipTrackPoint _last;
+};
+
+class AcsipTrackDecoder
+{
+public:
+    AcsipTrackDecoder(const uint8_t *data, size_t len);
+
+    // false if the header is broken or the version is unknown
+    bool valid() const;
+    uint8_t count() const;
+
+    // false once all points are read or the data is truncated
+    bool next(AcsipTrackPoint &point);
+
+private:
+    const uint8_t  *_data;
+    size_t          _len;
+    size_t          _pos;
+    uint8_t         _read;
+    AcsipTrackPoint _last;
+};
@@ -0,0 +1,289 @@
+#include "acsip_transfer.h"
+
+
+static inline void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static inline uint16_t get16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+AcsipTransfer::AcsipTransfer(Acsip &acsip) :
+    _acsip(acsip),
+    _window(ACSIP_XFER_DEFAULT_WINDOW),
+    _ackTimeout(ACSIP_XFER_DEFAULT_ACK_TIMEOUT),
+    _retry(ACSIP_XFER_DEFAULT_RETRY),
+    _id(0),
+    _total(0)
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void AcsipTransfer::setWindow(uint8_t window)
+{
+    if (window < 1) window = 1;
+    if (window > 32) window = 32;
+    _window = window;
+}
+
+void AcsipTransfer::setAckTimeout(uint16_t ms)
+{
+    _ackTimeout = ms;
+}
+
+void AcsipTransfer::setRetry(uint8_t retry)
+{
+    _retry = retry;
+}
+
+const AcsipTransferStats &AcsipTransfer::getStats()
+{
+    return _stats;
+}
+
+bool AcsipTransfer::isSet(uint16_t seq)
+{
+    return _bitmap[seq >> 3] & (1 << (seq & 7));
+}
+
+void AcsipTransfer::mark(uint16_t seq)
+{
+    _bitmap[seq >> 3] |= (1 << (seq & 7));
+}
+
+uint16_t AcsipTransfer::firstMissing(uint16_t from)
+{
+    while (from < _total && isSet(from)) {
+        from++;
+    }
+    return from;
+}
+
+int AcsipTransfer::sendAck(uint16_t total)
+{
+    uint8_t ack[ACSIP_XFER_ACK_SIZE];
+    uint16_t base = firstMissing(0);
+    uint32_t bits = 0;
+    for (uint8_t n = 0; n < 32 && base + n < total; n++) {
+        if (isSet(base + n)) {
+            bits |= (1UL << n);
+        }
+    }
+    ack[0] = ACSIP_XFER_ACK;
+    ack[1] = _id;
+    put16(&ack[2], base);
+    ack[4] = bits & 0xFF;
+    ack[5] = (bits >> 8) & 0xFF;
+    ack[6] = (bits >> 16) & 0xFF;
+    ack[7] = (bits >> 24) & 0xFF;
+    _stats.acks++;
+    return _acsip.RfSend(ack, sizeof(ack));
+}
+
+int AcsipTransfer::send(const uint8_t *data, size_t len)
+{
+    if (len == 0 || len > (size_t)ACSIP_XFER_MAX_FRAGMENTS * ACSIP_XFER_FRAGMENT_SIZE) {
+        return S7XG_INVALD_LEN;
+    }
+
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_bitmap, 0, sizeof(_bitmap));
+    _total = (len + ACSIP_XFER_FRAGMENT_SIZE - 1) / ACSIP_XFER_FRAGMENT_SIZE;
+    _id++;
+
+    uint32_t start = millis();
+    uint16_t base = 0;
+    uint16_t fresh = 0;     // first fragment never sent
+    uint8_t misses = 0;
+    int rssi, snr;
+
+    while (base < _total) {
+        uint16_t end = base + _window;
+        if (end > _total) end = _total;
+
+        uint16_t last = base;
+        for (uint16_t seq = base; seq < end; seq++) {
+            if (!isSet(seq)) last = seq;
+        }
+
+        _stats.rounds++;
+        for (uint16_t seq = base; seq < end; seq++) {
+            if (isSet(seq)) {
+                continue;
+            }
+            size_t offset = (size_t)seq * ACSIP_XFER_FRAGMENT_SIZE;
+            size_t size = len - offset;
+            if (size > ACSIP_XFER_FRAGMENT_SIZE) size = ACSIP_XFER_FRAGMENT_SIZE;
+
+            _frame[0] = ACSIP_XFER_DATA | (seq == last ? ACSIP_XFER_FLAG_ROUND_END : 0);
+            _frame[1] = _id;
+            put16(&_frame[2], seq);
+            put16(&_frame[4], _total);
+            memcpy(&_frame[ACSIP_XFER_HEADER_SIZE], data + offset, size);
+
+            int ret = _acsip.RfSend(_frame, ACSIP_XFER_HEADER_SIZE + size);
+            if (ret != S7XG_OK) {
+                return ret;
+            }
+            _stats.framesSent++;
+            if (seq < fresh) {
+                _stats.retransmissions++;
+            } else {
+                fresh = seq + 1;
+            }
+        }
+
+        //Wait for the selective ACK of this round
+        bool acked = false;
+        uint32_t wait = millis();
+        while (!acked && millis() - wait < _ackTimeout) {
+            size_t n = sizeof(_frame);
+            if (_acsip.RfReceive(_frame, n, rssi, snr, _ackTimeout) != S7XG_OK) {
+                break;
+            }
+            if (n < ACSIP_XFER_ACK_SIZE || _frame[0] != ACSIP_XFER_ACK || _frame[1] != _id) {
+                continue;
+            }
+            uint16_t ackBase = get16(&_frame[2]);
+            uint32_t bits = _frame[4] | ((uint32_t)_frame[5] << 8) |
+                            ((uint32_t)_frame[6] << 16) | ((uint32_t)_frame[7] << 24);
+            for (uint16_t seq = base; seq < ackBase && seq < _total; seq++) {
+                mark(seq);
+            }
+            for (uint8_t k = 0; k < 32; k++) {
+                if ((bits & (1UL << k)) && ackBase + k < _total) {
+                    mark(ackBase + k);
+                }
+            }
+            _stats.acks++;
+            acked = true;
+        }
+
+        if (!acked) {
+            _stats.timeouts++;
+            if (++misses > _retry) {
+                _stats.elapsed = millis() - start;
+                return S7XG_TIMEROUT;
+            }
+            continue;
+        }
+        misses = 0;
+        base = firstMissing(base);
+    }
+
+    _stats.bytes = len;
+    _stats.fragments = _total;
+    _stats.elapsed = millis() - start;
+    return S7XG_OK;
+}
+
+int AcsipTransfer::receive(uint8_t *data, size_t &len, uint32_t timeout)
+{
+    size_t size = len;
+    size_t lastSize = 0;
+    bool started = false;
+    uint8_t misses = 0;
+    uint32_t start = millis();
+    int rssi, snr;
+
+    len = 0;
+    _total = 0;
+    memset(&_stats, 0, sizeof(_stats));
+    memset(_bitmap, 0, sizeof(_bitmap));
+
+    while (1) {
+        size_t n = sizeof(_frame);
+        //Answer a little before the sender gives up on its ACK window
+        uint16_t window = started ? _ackTimeout / 2 : _ackTimeout;
+        int ret = _acsip.RfReceive(_frame, n, rssi, snr, window);
+
+        if (ret != S7XG_OK || n < ACSIP_XFER_HEADER_SIZE ||
+                (_frame[0] & 0x7F) != ACSIP_XFER_DATA ||
+                (started && _frame[1] != _id)) {
+            if (!started) {
+                if (millis() - start > timeout) {
+                    return S7XG_TIMEROUT;
+                }
+                continue;
+            }
+            //The round end frame may be lost, report what we have
+            _stats.timeouts++;
+            if (++misses > _retry) {
+                _stats.elapsed = millis() - start;
+                return S7XG_TIMEROUT;
+            }
+            sendAck(_total);
+            continue;
+        }
+        misses = 0;
+
+        uint16_t seq = get16(&_frame[2]);
+        uint16_t total = get16(&_frame[4]);
+        size_t payload = n - ACSIP_XFER_HEADER_SIZE;
+
+        if (!started) {
+            if (total == 0 || total > ACSIP_XFER_MAX_FRAGMENTS ||
+                    (size_t)(total - 1) * ACSIP_XFER_FRAGMENT_SIZE >= size) {
+                return S7XG_INVALD_LEN;
+            }
+            _id = _frame[1];
+            _total = total;
+            started = true;
+            start = millis();
+        }
+        if (seq >= _total || payload > ACSIP_XFER_FRAGMENT_SIZE) {
+            continue;
+        }
+
+        size_t offset = (size_t)seq * ACSIP_XFER_FRAGMENT_SIZE;
+        if (offset + payload > size) {
+            return S7XG_INVALD_LEN;
+        }
+        if (isSet(seq)) {
+            _stats.retransmissions++;
+        } else {
+            memcpy(data + offset, &_frame[ACSIP_XFER_HEADER_SIZE], payload);
+            mark(seq);
+            _stats.fragments++;
+            if (seq == _total - 1) {
+                lastSize = payload;
+            }
+        }
+
+        if (_frame[0] & ACSIP_XFER_FLAG_ROUND_END) {
+            sendAck(_total);
+        }
+
+        if (firstMissing(0) >= _total) {
+            break;
+        }
+    }
+
+    len = (size_t)(_total - 1) * ACSIP_XFER_FRAGMENT_SIZE + lastSize;
+    _stats.bytes = len;
+    _stats.elapsed = millis() - start;
+
+    //If the final ACK got lost the sender repeats its last round after its
+    //own ACK timeout plus the airtime of a fragment, so answer silence with
+    //the ACK again and linger for as many windows as the sender retries
+    uint8_t silent = 0;
+    while (silent < _retry) {
+        size_t n = sizeof(_frame);
+        if (_acsip.RfReceive(_frame, n, rssi, snr, _ackTimeout) != S7XG_OK) {
+            silent++;
+            sendAck(_total);
+            continue;
+        }
+        if (n >= ACSIP_XFER_HEADER_SIZE && (_frame[0] & 0x7F) == ACSIP_XFER_DATA && _frame[1] == _id) {
+            silent = 0;
+            if (_frame[0] & ACSIP_XFER_FLAG_ROUND_END) {
+                sendAck(_total);
+            }
+        }
+    }
+    return S7XG_OK;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Reliable bulk transfer over the P2P radio ("rf tx" / "rf rx").
+ *
+ * A blob is cut into numbered fragments. The sender transmits every
+ * unacknowledged fragment of the current window back-to-back, then listens
+ * for a selective acknowledgement. Only the fragments missing from the
+ * acknowledgement bitmap are sent again in the next round.
+ *
+ * DATA frame : [type|flags] [id] [seq LE16] [total LE16] [payload ...]
+ * ACK  frame : [type]       [id] [base LE16] [bitmap LE32]
+ *
+ * The ACK base is the first fragment not yet received, bit n of the bitmap
+ * means fragment (base + n) has been received.
+ */
+
+// Payload bytes per fragment. The received hex line has to fit into the
+// command buffer and the receive arena: "radio_rx " + 2 * (6 + 96) + " rssi snr"
+#ifndef ACSIP_XFER_FRAGMENT_SIZE
+#define ACSIP_XFER_FRAGMENT_SIZE        96
+#endif
+
+// Upper bound of fragments per transfer, 1024 * 96 = 96KB
+#ifndef ACSIP_XFER_MAX_FRAGMENTS
+#define ACSIP_XFER_MAX_FRAGMENTS        1024
+#endif
+
+// Fragments in flight per round, it can be from 1 to 32
+#define ACSIP_XFER_DEFAULT_WINDOW       8
+#define ACSIP_XFER_DEFAULT_ACK_TIMEOUT  3000
+#define ACSIP_XFER_DEFAULT_RETRY        8
+
+#define ACSIP_XFER_HEADER_SIZE          6
+#define ACSIP_XFER_ACK_SIZE             8
+
+// Longest line of a transfer: "radio_rx " + hex frame + " -128 -20" and the
+// line end, the receive arena also keeps the "\n\r>> " reply prefix
+#define ACSIP_XFER_LINE_SIZE            (9 + 2 * (ACSIP_XFER_HEADER_SIZE + ACSIP_XFER_FRAGMENT_SIZE) + 12)
+
+static_assert(ACSIP_BUFFER_SIZE >= ACSIP_XFER_LINE_SIZE,
+              "ACSIP_BUFFER_SIZE is too small for ACSIP_XFER_FRAGMENT_SIZE");
+static_assert(ACSIP_RX_SIZE >= 5 + ACSIP_XFER_LINE_SIZE,
+              "ACSIP_RX_SIZE is too small for ACSIP_XFER_FRAGMENT_SIZE, raise it or lower the fragment size");
+
+enum AcsipTransferFrame {
+    ACSIP_XFER_DATA = 0x01,
+    ACSIP_XFER_ACK  = 0x02,
+};
+
+// Set on the last DATA frame of a round, the receiver answers with an ACK
+#define ACSIP_XFER_FLAG_ROUND_END       0x80
+
+struct AcsipTransferStats {
+    uint32_t bytes;
+    uint32_t fragments;
+    uint32_t framesSent;
+    uint32_t retransmissions;
+    uint32_t acks;
+    uint32_t timeouts;
+    uint32_t rounds;
+    uint32_t elapsed;           // ms
+
+    // Goodput in bytes per second
+    uint32_t throughput() const
+    {
+        return elapsed ? (uint32_t)((uint64_t)bytes * 1000 / elapsed) : 0;
+    }
+};
+
+class AcsipTransfer
+{
+public:
+    AcsipTransfer(Acsip &acsip);
+
+    void setWindow(uint8_t window);
+    void setAckTimeout(uint16_t ms);
+    void setRetry(uint8_t retry);
+
+    /**
+     * @brief  send
+     * @note   Blocks until every fragment is acknowledged, or no ACK
+     *         arrives for 'retry' rounds in a row.
+     * @param  data: blob to transfer
+     * @param  len: blob length, at most ACSIP_XFER_MAX_FRAGMENTS * ACSIP_XFER_FRAGMENT_SIZE
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int send(const uint8_t *data, size_t len);
+
+    /**
+     * @brief  receive
+     * @note   Waits for the first fragment up to 'timeout' ms, then until the
+     *         blob is complete or the sender goes quiet. After the last
+     *         fragment it lingers up to 'retry' ACK timeouts, so a lost
+     *         final ACK can be repeated.
+     * @param  data: destination buffer
+     * @param  len: buffer size on input, blob length on output
+     * @param  timeout: ms to wait for the transfer to start
+     * @retval status code , see 'S7XG_Error' enum
+     */
+    int receive(uint8_t *data, size_t &len, uint32_t timeout);
+
+    const AcsipTransferStats &getStats();
+
+private:
+    bool isSet(uint16_t seq);
+    void mark(uint16_t seq);
+    uint16_t firstMissing(uint16_t from);
+    int sendAck(uint16_t total);
+
+    Acsip          &_acsip;
+    uint8_t         _window;
+    uint16_t        _ackTimeout;
+    uint8_t         _retry;
+    uint8_t         _id;
+    uint16_t        _total;
+    uint8_t         _frame[ACSIP_XFER_HEADER_SIZE + ACSIP_XFER_FRAGMENT_SIZE];
+    uint8_t         _bitmap[ACSIP_XFER_MAX_FRAGMENTS / 8];
+    AcsipTransferStats _stats;
+};
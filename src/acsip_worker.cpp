@@ -0,0 +1,151 @@
+#include "acsip_worker.h"
+
+#ifdef ACSIP_HAS_WORKER
+
+#include <chrono>
+
+static_assert((ACSIP_WORKER_QUEUE_SIZE & (ACSIP_WORKER_QUEUE_SIZE - 1)) == 0,
+              "ACSIP_WORKER_QUEUE_SIZE must be a power of two");
+
+AcsipWorker::AcsipWorker(Acsip &acsip) :
+    _acsip(acsip),
+    _tail(0),
+    _head(0),
+    _inflightNext(0),
+    _running(false)
+{
+    for (size_t i = 0; i < ACSIP_WORKER_QUEUE_SIZE; i++) {
+        _slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+}
+
+AcsipWorker::~AcsipWorker()
+{
+    stop();
+}
+
+bool AcsipWorker::start()
+{
+    if (_running.exchange(true)) {
+        return false;
+    }
+    _thread = std::thread(&AcsipWorker::run, this);
+    return true;
+}
+
+void AcsipWorker::stop()
+{
+    _running.store(false);
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    drain();
+}
+
+//The worker thread is joined, the caller owns the Acsip object now
+void AcsipWorker::drain()
+{
+    _acsip.cancel(complete);
+    while (1) {
+        Slot *slot = &_slots[_head & (ACSIP_WORKER_QUEUE_SIZE - 1)];
+        if (slot->seq.load(std::memory_order_acquire) != _head + 1) {
+            break;
+        }
+        complete(&slot->promise, S7XG_FAILED, "");
+        slot->seq.store(_head + ACSIP_WORKER_QUEUE_SIZE, std::memory_order_release);
+        _head++;
+    }
+}
+
+static std::future<AcsipResult> failed(int err)
+{
+    std::promise<AcsipResult> promise;
+    AcsipResult result;
+    result.err = err;
+    result.ack[0] = '\0';
+    promise.set_value(result);
+    return promise.get_future();
+}
+
+std::future<AcsipResult> AcsipWorker::submit(const char *cmd, uint8_t frames, uint32_t timeout)
+{
+    if (strlen(cmd) >= ACSIP_REQUEST_SIZE) {
+        return failed(S7XG_INVALD_LEN);
+    }
+
+    size_t pos = _tail.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (1) {
+        slot = &_slots[pos & (ACSIP_WORKER_QUEUE_SIZE - 1)];
+        size_t seq = slot->seq.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return failed(S7XG_QUEUE_FULL);
+        } else {
+            pos = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    strcpy(slot->cmd, cmd);
+    slot->frames = frames;
+    slot->timeout = timeout;
+    slot->promise = std::promise<AcsipResult>();
+    std::future<AcsipResult> future = slot->promise.get_future();
+    slot->seq.store(pos + 1, std::memory_order_release);
+    return future;
+}
+
+void AcsipWorker::complete(void *arg, int err, const char *ack)
+{
+    std::promise<AcsipResult> *promise = (std::promise<AcsipResult> *)arg;
+    AcsipResult result;
+    result.err = err;
+    strncpy(result.ack, ack, sizeof(result.ack) - 1);
+    result.ack[sizeof(result.ack) - 1] = '\0';
+    promise->set_value(result);
+}
+
+//Single consumer, only called from the worker thread
+bool AcsipWorker::pop()
+{
+    Slot *slot = &_slots[_head & (ACSIP_WORKER_QUEUE_SIZE - 1)];
+    if (slot->seq.load(std::memory_order_acquire) != _head + 1) {
+        return false;
+    }
+
+    //Acsip completes commands in submission order and holds at most
+    //ACSIP_QUEUE_SIZE of them, so a promise is done before its slot is reused
+    std::promise<AcsipResult> *promise = &_inflight[_inflightNext];
+    *promise = std::move(slot->promise);
+    _inflightNext = (_inflightNext + 1) % ACSIP_QUEUE_SIZE;
+
+    int ret = _acsip.submit(slot->cmd, complete, promise, slot->frames, slot->timeout);
+    if (ret != S7XG_OK) {
+        complete(promise, ret, "");
+    }
+    slot->seq.store(_head + ACSIP_WORKER_QUEUE_SIZE, std::memory_order_release);
+    _head++;
+    return true;
+}
+
+void AcsipWorker::run()
+{
+    while (_running.load(std::memory_order_relaxed)) {
+        bool busy = false;
+        while (_acsip.queued() < ACSIP_QUEUE_SIZE && pop()) {
+            busy = true;
+        }
+        if (_acsip.process()) {
+            busy = true;
+        }
+        if (!busy) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+#endif
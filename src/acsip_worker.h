@@ -0,0 +1,87 @@
+#pragma once
+
+#include "acsip.h"
+
+/*
+ * Optional I/O thread per module (Linux hosts and ESP32).
+ *
+ * The worker thread is the only owner of the Acsip object: it drives the
+ * command queue and receive framer (Acsip::submit / Acsip::process).
+ * Application threads post commands through a bounded lock-free MPSC queue
+ * and get a std::future with the final reply. Do not call the Acsip object
+ * directly while the worker is running.
+ */
+
+#if defined(__linux__) || defined(ARDUINO_ARCH_ESP32)
+#define ACSIP_HAS_WORKER
+#endif
+
+#ifdef ACSIP_HAS_WORKER
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+// Must be a power of two
+#ifndef ACSIP_WORKER_QUEUE_SIZE
+#define ACSIP_WORKER_QUEUE_SIZE         16
+#endif
+
+struct AcsipResult {
+    int  err;
+    char ack[ACSIP_BUFFER_SIZE];
+};
+
+class AcsipWorker
+{
+public:
+    AcsipWorker(Acsip &acsip);
+    ~AcsipWorker();
+
+    bool start();
+
+    /**
+     * @brief  stop
+     * @note   Joins the worker thread, then fails every command that has not
+     *         completed with S7XG_FAILED, so no future is left waiting and
+     *         the Acsip queue holds no reference to this worker.
+     */
+    void stop();
+
+    /**
+     * @brief  submit
+     * @note   Thread safe and lock free, can be called from any thread.
+     * @param  cmd: command line
+     * @param  frames: reply frames, see Acsip::submit
+     * @param  timeout: ms for the whole exchange, 0 uses the Acsip timeout
+     * @retval future holding the result, S7XG_QUEUE_FULL if the queue is full,
+     *         S7XG_INVALD_LEN if cmd does not fit ACSIP_REQUEST_SIZE
+     */
+    std::future<AcsipResult> submit(const char *cmd, uint8_t frames = 1, uint32_t timeout = 0);
+
+private:
+    struct Slot {
+        std::atomic<size_t>         seq;
+        char                        cmd[ACSIP_REQUEST_SIZE];
+        uint8_t                     frames;
+        uint32_t                    timeout;
+        std::promise<AcsipResult>   promise;
+    };
+
+    static void complete(void *arg, int err, const char *ack);
+    bool pop();
+    void run();
+    void drain();
+
+    Acsip                      &_acsip;
+    Slot                        _slots[ACSIP_WORKER_QUEUE_SIZE];
+    std::atomic<size_t>         _tail;
+    size_t                      _head;
+    // Promises of the commands handed to the Acsip queue
+    std::promise<AcsipResult>   _inflight[ACSIP_QUEUE_SIZE];
+    uint8_t                     _inflightNext;
+    std::atomic<bool>           _running;
+    std::thread                 _thread;
+};
+
+#endif
@@ -2,815 +2,177 @@
 // Generated from: 24.bmp
 // Time generated: 1/8/2020 11:20:30 AM
 // Dimensions    : 168x77 pixels
-// Size          : 25,872 Bytes
+// Size          : 25,872 Bytes raw, 2583 Bytes compressed
+// Format        : palette + run length, decode with AcsipRleDecoder
 
-const unsigned short acsiplogo[0x3288] ={
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0010 (16)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0020 (32)
-0xEFDF, 0xAF1C, 0x769A, 0x4E39, 0x35F8, 0x35D8, 0x35D8, 0x4618, 0x6659, 0x8EDB, 0xC77D, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0030 (48)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0040 (64)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0050 (80)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0060 (96)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0070 (112)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x3DF8,   // 0x0080 (128)
-0x4E19, 0x5E59, 0x7E9A, 0xA71C, 0xD79E, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0090 (144)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00A0 (160)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00B0 (176)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00C0 (192)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDFBE, 0x769A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x00D0 (208)
-0x35D8, 0x35D8, 0x35D8, 0x4E19, 0xB73C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00E0 (224)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x00F0 (240)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0100 (256)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0110 (272)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0120 (288)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4618, 0x8EDB, 0xDFBE,   // 0x0130 (304)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0140 (320)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0150 (336)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0160 (352)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x96DB, 0x35D8, 0x35D8,   // 0x0170 (368)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5E59, 0xDFBE, 0x0000,   // 0x0180 (384)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0190 (400)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01A0 (416)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01B0 (432)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01C0 (448)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x35D8,   // 0x01D0 (464)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x769A, 0xDFBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01E0 (480)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01F0 (496)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0200 (512)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0210 (528)
-0x0000, 0x0000, 0x0000, 0xEFDF, 0x6659, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0220 (544)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x3DF8, 0xC75D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0230 (560)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0240 (576)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0250 (592)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0260 (608)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0270 (624)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xF7DF, 0xE7BE, 0xCF7D, 0xAF1C, 0x7E9A, 0x4618, 0x35D8, 0x35D8, 0x35D8,   // 0x0280 (640)
-0x35D8, 0x35D8, 0x96DB, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0290 (656)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02A0 (672)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02B0 (688)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0x5639, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x02C0 (704)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x02D0 (720)
-0xBF5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02E0 (736)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x02F0 (752)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0300 (768)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0310 (784)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0320 (800)
-0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xC75D, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5E59, 0xE7BE, 0x0000, 0x0000, 0x0000,   // 0x0330 (816)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0340 (832)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0350 (848)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0360 (864)
-0x0000, 0xFFFF, 0x5E59, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0370 (880)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35F8, 0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0380 (896)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0390 (912)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03A0 (928)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03B0 (944)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03C0 (960)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD79E,   // 0x03D0 (976)
-0x5E59, 0x35D8, 0x35D8, 0x35D8, 0x4618, 0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03E0 (992)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x03F0 (1008)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0400 (1024)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8EDB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0410 (1040)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0420 (1056)
-0x35D8, 0x4E19, 0xF7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0430 (1072)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0440 (1088)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0450 (1104)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0460 (1120)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x3DF8,   // 0x0470 (1136)
-0x4E18, 0x665A, 0x8EDB, 0xCF7D, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x9EFC, 0x35D8, 0x35D8, 0x35D8, 0x3DF8, 0xD79E, 0x0000,   // 0x0480 (1152)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0490 (1168)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04A0 (1184)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04B0 (1200)
-0xDFBE, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x04C0 (1216)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x8EDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04D0 (1232)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04E0 (1248)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x04F0 (1264)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0500 (1280)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0510 (1296)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4618, 0x9EFC, 0xF7FF, 0x0000,   // 0x0520 (1312)
-0x0000, 0x0000, 0xCF7D, 0x3DF8, 0x35D8, 0x35D8, 0x45F8, 0xE7BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0530 (1328)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0540 (1344)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0550 (1360)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7E9A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0560 (1376)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0570 (1392)
-0x35D8, 0x35D8, 0x3DF8, 0xEFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0580 (1408)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0590 (1424)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05A0 (1440)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05B0 (1456)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x4E39,   // 0x05C0 (1472)
-0x3DF8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4618, 0xBF5D, 0x0000, 0x0000, 0x0000, 0xD79E, 0x3DF8, 0x35D8, 0x35D8, 0x5E59,   // 0x05D0 (1488)
-0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05E0 (1504)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x05F0 (1520)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BE,   // 0x0600 (1536)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0610 (1552)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xA71C, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0620 (1568)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0630 (1584)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0640 (1600)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0650 (1616)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0660 (1632)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0xB73D, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0670 (1648)
-0x8EDB, 0xFFFF, 0x0000, 0x0000, 0xCF7D, 0x35D8, 0x35D8, 0x35D8, 0x8EDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0680 (1664)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0690 (1680)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06A0 (1696)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x86BB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x06B0 (1712)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x06C0 (1728)
-0x35D8, 0x35D8, 0x35D8, 0x5E59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06D0 (1744)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06E0 (1760)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x06F0 (1776)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0700 (1792)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0710 (1808)
-0x0000, 0x0000, 0x0000, 0x0000, 0xDF9E, 0x665A, 0x35D8, 0x35D8, 0x35D8, 0x7E9A, 0xFFFF, 0x0000, 0x0000, 0xA71C, 0x35D8, 0x35D8,   // 0x0720 (1824)
-0x35D8, 0xDF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0730 (1840)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0740 (1856)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0x35F8,   // 0x0750 (1872)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35F8, 0x86BB, 0xBF3D, 0xAF1C, 0x5639,   // 0x0760 (1888)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xF7FF, 0x0000, 0x0000, 0x0000,   // 0x0770 (1904)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0780 (1920)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0790 (1936)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07A0 (1952)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07B0 (1968)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x9EFC, 0x35D8,   // 0x07C0 (1984)
-0x35D8, 0x35D8, 0x8EDB, 0x0000, 0x0000, 0xFFFF, 0x5E59, 0x35D8, 0x35D8, 0x6E7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07D0 (2000)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07E0 (2016)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x07F0 (2032)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96DB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0800 (2048)
-0x35D8, 0x35D8, 0x35F8, 0xD77E, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0810 (2064)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0820 (2080)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0830 (2096)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0840 (2112)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0850 (2128)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x4E19,   // 0x0860 (2144)
-0x6659, 0x96FB, 0xDF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0xB73D, 0x35D8, 0x35D8, 0x35D8, 0xC75D, 0x0000, 0x0000, 0xD79E, 0x35D8,   // 0x0870 (2160)
-0x35D8, 0x35D8, 0xDF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0880 (2176)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0890 (2192)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x3DF8, 0x35D8,   // 0x08A0 (2208)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08B0 (2224)
-0xEFBF, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xC75D, 0x0000, 0x0000, 0x0000,   // 0x08C0 (2240)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08D0 (2256)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08E0 (2272)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x08F0 (2288)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0900 (2304)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x7E9A, 0xEFDF, 0x0000, 0x0000, 0x0000,   // 0x0910 (2320)
-0x9EFC, 0x35D8, 0x35D8, 0x4618, 0xF7FF, 0x0000, 0x0000, 0x6E7A, 0x35D8, 0x35D8, 0x86BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0920 (2336)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0930 (2352)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0940 (2368)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EFC, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0950 (2384)
-0x35D8, 0x35F8, 0xEFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4618, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0960 (2400)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xAF3C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0970 (2416)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0980 (2432)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0990 (2448)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09A0 (2464)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x9EFC,   // 0x09B0 (2480)
-0x7E9A, 0x3DF8, 0x35D8, 0x35D8, 0x4618, 0xE7BE, 0x0000, 0x0000, 0xFFFF, 0x6659, 0x35D8, 0x35D8, 0x9EFC, 0x0000, 0x0000, 0xC77D,   // 0x09C0 (2496)
-0x35D8, 0x35D8, 0x3DF8, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09D0 (2512)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x09E0 (2528)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4618, 0x35D8, 0x35D8,   // 0x09F0 (2544)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x86BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A00 (2560)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xA6FC, 0x0000, 0x0000, 0x0000,   // 0x0A10 (2576)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A20 (2592)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A30 (2608)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A40 (2624)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A50 (2640)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7FF, 0x96FB, 0x35D8, 0x35D8, 0x4E18, 0xF7DF, 0x0000,   // 0x0A60 (2656)
-0x0000, 0xD79E, 0x35D8, 0x35D8, 0x4618, 0xFFFF, 0x0000, 0xFFFF, 0x4618, 0x35D8, 0x35D8, 0xCF7E, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A70 (2672)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A80 (2688)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0A90 (2704)
-0x0000, 0x0000, 0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0AA0 (2720)
-0x35D8, 0xE7BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0AB0 (2736)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AC0 (2752)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AD0 (2768)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AE0 (2784)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0AF0 (2800)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC69C, 0x8D39, 0x8D39,   // 0x0B00 (2816)
-0xCEBC, 0xFFFF, 0xFFFF, 0xBF5D, 0x35D8, 0x35D8, 0x7EBA, 0x0000, 0x0000, 0x0000, 0x6659, 0x35D8, 0x35D8, 0xCF7D, 0x0000, 0x0000,   // 0x0B10 (2832)
-0x7E9A, 0x35D8, 0x35D8, 0x9EFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B20 (2848)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B30 (2864)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4E19, 0x35D8, 0x35D8, 0x35D8,   // 0x0B40 (2880)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x7E9A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B50 (2896)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x0B60 (2912)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B70 (2928)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B80 (2944)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0B90 (2960)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BA0 (2976)
-0x0000, 0x0000, 0x0000, 0xF79F, 0x4B95, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x53F6, 0xF7BF, 0xFFFF, 0x8EDB, 0x35D8, 0x35D8, 0xE7BF,   // 0x0BB0 (2992)
-0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x96DB, 0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x769A, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BC0 (3008)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BD0 (3024)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0BE0 (3040)
-0x0000, 0x0000, 0x0000, 0xBF3D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0BF0 (3056)
-0xDF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0C00 (3072)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C10 (3088)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C20 (3104)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C30 (3120)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C40 (3136)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53D6, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x0C50 (3152)
-0x01D1, 0x01D1, 0x6437, 0xFFFF, 0xF7DF, 0x35F8, 0x35D8, 0xA71C, 0x0000, 0x0000, 0xDFBE, 0x35D8, 0x35D8, 0x6E7A, 0x0000, 0x0000,   // 0x0C60 (3168)
-0xCF7D, 0x35D8, 0x35D8, 0x5E39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C70 (3184)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0C80 (3200)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x5639, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0C90 (3216)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x6E7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CA0 (3232)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x0CB0 (3248)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CC0 (3264)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CD0 (3280)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CE0 (3296)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0CF0 (3312)
-0x0000, 0x0000, 0xD6FD, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01F1, 0xEF7E, 0x0000, 0x665A, 0x35D8, 0x769A,   // 0x0D00 (3328)
-0x0000, 0x0000, 0xFFFF, 0x35D8, 0x35D8, 0x5639, 0x0000, 0x0000, 0xE7BE, 0x35D8, 0x35D8, 0x4E18, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D10 (3344)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D20 (3360)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D30 (3376)
-0x0000, 0x0000, 0xC75D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xCF7E,   // 0x0D40 (3392)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0D50 (3408)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D60 (3424)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D70 (3440)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D80 (3456)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0D90 (3472)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5DB, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x0DA0 (3488)
-0x01D1, 0x01D1, 0x01D1, 0xBE5C, 0x0000, 0x9EFC, 0x5639, 0x86BB, 0x0000, 0x0000, 0x0000, 0x6659, 0x5639, 0x6E7A, 0x0000, 0x0000,   // 0x0DB0 (3504)
-0xEFDF, 0x5639, 0x5639, 0x6659, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DC0 (3520)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DD0 (3536)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6659, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0DE0 (3552)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x6659, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0DF0 (3568)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x0E00 (3584)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E10 (3600)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E20 (3616)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E30 (3632)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E40 (3648)
-0x0000, 0x0000, 0xB63B, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xCEBC, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E50 (3664)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E60 (3680)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E70 (3696)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0E80 (3712)
-0x0000, 0xD77E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xC75D, 0x0000,   // 0x0E90 (3728)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0EA0 (3744)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EB0 (3760)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EC0 (3776)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0ED0 (3792)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0EE0 (3808)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF79F, 0x1232, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x0EF0 (3824)
-0x01D1, 0x01D1, 0x1A73, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F00 (3840)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F10 (3856)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F20 (3872)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0F30 (3888)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5639, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F40 (3904)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x0F50 (3920)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F60 (3936)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F70 (3952)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F80 (3968)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0F90 (3984)
-0x0000, 0x0000, 0x0000, 0x9D9A, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01F2, 0xB61B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FA0 (4000)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FB0 (4016)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FC0 (4032)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0FD0 (4048)
-0xDF9E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xB73D, 0x0000, 0x0000,   // 0x0FE0 (4064)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x0FF0 (4080)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1000 (4096)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1010 (4112)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1020 (4128)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1030 (4144)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB61B, 0x32F4, 0x01D1, 0x01D1,   // 0x1040 (4160)
-0x3B34, 0xBE7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1050 (4176)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1060 (4192)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1070 (4208)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7E9A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1080 (4224)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4E19, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1090 (4240)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x10A0 (4256)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10B0 (4272)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10C0 (4288)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10D0 (4304)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10E0 (4320)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0xF7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x10F0 (4336)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1100 (4352)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1110 (4368)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BE,   // 0x1120 (4384)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xAF1C, 0x0000, 0x0000, 0x0000,   // 0x1130 (4400)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1140 (4416)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1150 (4432)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1160 (4448)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1170 (4464)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1180 (4480)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1190 (4496)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11A0 (4512)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11B0 (4528)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11C0 (4544)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x86BB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x11D0 (4560)
-0x35D8, 0x35D8, 0x35D8, 0x4618, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x11E0 (4576)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x11F0 (4592)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0xBF5D, 0x96FB, 0x769A, 0x667A,   // 0x1200 (4608)
-0x6659, 0x665A, 0x769A, 0x96DB, 0xBF5D, 0xF7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1210 (4624)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xBE7C, 0x8519, 0x5C16, 0x4375, 0x3B35, 0x32F4, 0x32F4, 0x32F4,   // 0x1220 (4640)
-0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0xA5DA,   // 0x1230 (4656)
-0x0000, 0x0000, 0xADFB, 0x2293, 0x2293, 0x2293, 0x2293, 0x2293, 0x2293, 0x2293, 0x2293, 0xBE5C, 0x0000, 0x0000, 0x8D39, 0x32F4,   // 0x1240 (4672)
-0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x32F4, 0x0000, 0x0000, 0x0000, 0xE75E, 0x9DBA, 0x6C77, 0x4B95, 0x3B34, 0x32F4,   // 0x1250 (4688)
-0x4355, 0x53D6, 0x7CD8, 0xB63B, 0xF7BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1260 (4704)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0x35F8,   // 0x1270 (4720)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x9EFC, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1280 (4736)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1290 (4752)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x12A0 (4768)
-0xFFFF, 0xC75D, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x6E7A, 0xC77D,   // 0x12B0 (4784)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFDF, 0x8D39, 0x1A73,   // 0x12C0 (4800)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x12D0 (4816)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x12E0 (4832)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xFFDF,   // 0x12F0 (4848)
-0xA5BA, 0x3B34, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0A12, 0x6417, 0xCEBD, 0x0000,   // 0x1300 (4864)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1310 (4880)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96DB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1320 (4896)
-0x35D8, 0x35D8, 0x3DF8, 0xF7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1330 (4912)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x1340 (4928)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD79E, 0x5E59, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1350 (4944)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5E59, 0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1360 (4960)
-0x0000, 0x0000, 0x0000, 0x0000, 0xDF3E, 0x32F4, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1370 (4976)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559,   // 0x1380 (4992)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1390 (5008)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2293, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x13A0 (5024)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x53F6, 0xE75E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13B0 (5040)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x3DF8, 0x35D8,   // 0x13C0 (5056)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x8EDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x13D0 (5072)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x13E0 (5088)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x9EFC, 0x35D8,   // 0x13F0 (5104)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1400 (5120)
-0x35D8, 0x35D8, 0x9EFC, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE77E, 0x2293, 0x01D1, 0x01D1, 0x01D1,   // 0x1410 (5136)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1420 (5152)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1430 (5168)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1440 (5184)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1450 (5200)
-0x1232, 0xADFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1460 (5216)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EFC, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1470 (5232)
-0x35D8, 0x35F8, 0xEFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1480 (5248)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x1490 (5264)
-0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x767A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x14A0 (5280)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x769A, 0xF7FF, 0x0000, 0x0000, 0x0000,   // 0x14B0 (5296)
-0x0000, 0x0000, 0xFFFF, 0x4B95, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x14C0 (5312)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559,   // 0x14D0 (5328)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x14E0 (5344)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x14F0 (5360)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x8519, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1500 (5376)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4618, 0x35D8, 0x35D8,   // 0x1510 (5392)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x86BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1520 (5408)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1530 (5424)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x6E7A, 0x35D8, 0x35D8, 0x35D8,   // 0x1540 (5440)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1550 (5456)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x667A, 0xF7FF, 0x0000, 0x0000, 0x0000, 0x0000, 0xAE1B, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1560 (5472)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1570 (5488)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1580 (5504)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1590 (5520)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x15A0 (5536)
-0x01D1, 0x01D1, 0x01D1, 0x7CD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15B0 (5552)
-0x0000, 0x0000, 0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x15C0 (5568)
-0x35D8, 0xE7BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x15D0 (5584)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x15E0 (5600)
-0x0000, 0x0000, 0x0000, 0x7EBA, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x15F0 (5616)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x667A, 0xFFFF, 0x0000,   // 0x1600 (5632)
-0x0000, 0x0000, 0x3314, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1610 (5648)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559,   // 0x1620 (5664)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1630 (5680)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1640 (5696)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559, 0x0000, 0x0000, 0x0000,   // 0x1650 (5712)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4E19, 0x35D8, 0x35D8, 0x35D8,   // 0x1660 (5728)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x769A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1670 (5744)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1680 (5760)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1690 (5776)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x16A0 (5792)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x3DF8, 0xCF7E, 0x0000, 0x0000, 0xD6FD, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x16B0 (5808)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x16C0 (5824)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x16D0 (5840)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x16E0 (5856)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x16F0 (5872)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0A12, 0xD6DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1700 (5888)
-0x0000, 0x0000, 0x0000, 0xBF3D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1710 (5904)
-0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1720 (5920)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x1730 (5936)
-0x0000, 0xEFDF, 0x3DF8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x3DF8, 0x6659,   // 0x1740 (5952)
-0x6E7A, 0x5E59, 0x3DF8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x665A, 0xE7BE, 0x0000, 0x0000,   // 0x1750 (5968)
-0x0000, 0x8D39, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01F1, 0x3B55, 0x53D6, 0x53D6, 0x53D6, 0x53D6,   // 0x1760 (5984)
-0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0x53D6, 0xB63B,   // 0x1770 (6000)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1780 (6016)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x22B3, 0x4BB6, 0x53D6,   // 0x1790 (6032)
-0x3B34, 0x0A12, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x3B35, 0xFFFF, 0x0000,   // 0x17A0 (6048)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x5639, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x17B0 (6064)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x6E7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17C0 (6080)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x17D0 (6096)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x86BB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x17E0 (6112)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x667A, 0xCF7E, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xC75D, 0x665A, 0x35D8, 0x35D8, 0x35D8,   // 0x17F0 (6128)
-0x35D8, 0x35D8, 0x35F8, 0xA71C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C57, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1800 (6144)
-0x01D1, 0x01D1, 0xAE1B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1810 (6160)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1820 (6176)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1830 (6192)
-0x01D1, 0x01D1, 0x01F1, 0x6457, 0xDF1D, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7BF, 0x9D9A, 0x2293, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1840 (6208)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xADFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1850 (6224)
-0x0000, 0x0000, 0xC75D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xCF7D,   // 0x1860 (6240)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1870 (6256)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x1880 (6272)
-0xF7DF, 0x35F8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xA71C, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1890 (6288)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA6FC, 0x35D8, 0x35D8, 0x35D8, 0x6659, 0xE7BE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18A0 (6304)
-0x0000, 0x53D6, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x1A73, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18B0 (6320)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18C0 (6336)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x18D0 (6352)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x1A53, 0xC67C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x18E0 (6368)
-0x0000, 0x0000, 0x0000, 0xF7DF, 0x6417, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x3314, 0x0000,   // 0x18F0 (6384)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6659, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1900 (6400)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5E59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1910 (6416)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1920 (6432)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0xA71C, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1930 (6448)
-0x35D8, 0x35D8, 0xB73D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB73D, 0x3DF8,   // 0x1940 (6464)
-0xA71C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6417, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1950 (6480)
-0x01D1, 0x01F2, 0xE73E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1960 (6496)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1970 (6512)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1980 (6528)
-0x1232, 0xD6FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x6457, 0x01D1, 0x01D1,   // 0x1990 (6544)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xD6DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19A0 (6560)
-0x0000, 0xD79E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xBF5D, 0x0000,   // 0x19B0 (6576)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19C0 (6592)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x19D0 (6608)
-0x667A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x86BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19E0 (6624)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x19F0 (6640)
-0x0000, 0x74B8, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x22B3, 0x8D39, 0xA5BA, 0xA5BA, 0xA5BA, 0xA5BA,   // 0x1A00 (6656)
-0xA5BA, 0xA5BA, 0xA5BA, 0xA5BA, 0xADDB, 0xB63B, 0xDF1D, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A10 (6672)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1A20 (6688)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xADDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A30 (6704)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFDF, 0x3314, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x84F8,   // 0x1A40 (6720)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1A50 (6736)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5639, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A60 (6752)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1A70 (6768)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xFFFF, 0x35F8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1A80 (6784)
-0x3DF8, 0xEFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1A90 (6800)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5DA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1AA0 (6816)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0A12,   // 0x1AB0 (6832)
-0x53F6, 0xB63B, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1AC0 (6848)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x3314,   // 0x1AD0 (6864)
-0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC67C, 0x01D1,   // 0x1AE0 (6880)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x4375, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1AF0 (6896)
-0xDF9E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xB73C, 0x0000, 0x0000,   // 0x1B00 (6912)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B10 (6928)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xDFBE,   // 0x1B20 (6944)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x7E9A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B30 (6960)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B40 (6976)
-0x0000, 0xEF9E, 0x09F2, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1B50 (6992)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x3314, 0xD6FD, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B60 (7008)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1B70 (7024)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9D7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1B80 (7040)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22B3, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x1A73,   // 0x1B90 (7056)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7E9A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1BA0 (7072)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4E18, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BB0 (7088)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1BC0 (7104)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xC77D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1BD0 (7120)
-0xAF1C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1BE0 (7136)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6437, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1BF0 (7152)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1C00 (7168)
-0x01D1, 0x01D1, 0x01D1, 0x0A12, 0xB61B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1C10 (7184)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xDF1D,   // 0x1C20 (7200)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6417,   // 0x1C30 (7216)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BE,   // 0x1C40 (7232)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xA71C, 0x0000, 0x0000, 0x0000,   // 0x1C50 (7248)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C60 (7264)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xBF5D,   // 0x1C70 (7280)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xBF5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C80 (7296)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1C90 (7312)
-0x0000, 0x0000, 0xE75E, 0x1232, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1CA0 (7328)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0A12, 0xCEDD, 0x0000, 0x0000,   // 0x1CB0 (7344)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1CC0 (7360)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xF7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1CD0 (7376)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1CE0 (7392)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x86BB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1CF0 (7408)
-0x35D8, 0x35D8, 0x35D8, 0x3DF8, 0xF7FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D00 (7424)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1D10 (7440)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xBF5D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1D20 (7456)
-0xBF5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1D30 (7472)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB61B, 0x01F2, 0x01D1, 0x01D1, 0x01D1,   // 0x1D40 (7488)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1D50 (7504)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2AD4, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1D60 (7520)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xEF9F,   // 0x1D70 (7536)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C77,   // 0x1D80 (7552)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEFDF, 0x35F8,   // 0x1D90 (7568)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DA0 (7584)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DB0 (7600)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xCF7D,   // 0x1DC0 (7616)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xA71C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DD0 (7632)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1DE0 (7648)
-0x0000, 0x0000, 0x0000, 0x0000, 0xAE1B, 0x1232, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1DF0 (7664)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xA5BA, 0x0000,   // 0x1E00 (7680)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1E10 (7696)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xCEBD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E20 (7712)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4B95, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0A12,   // 0x1E30 (7728)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x96DB, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1E40 (7744)
-0x35D8, 0x35D8, 0x3DF8, 0xEFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E50 (7760)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1E60 (7776)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0xE7BF, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1E70 (7792)
-0x6E7A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E80 (7808)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF3E, 0x4B95, 0x01D1,   // 0x1E90 (7824)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1EA0 (7840)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x3B55, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1EB0 (7856)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x8519,   // 0x1EC0 (7872)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7BF, 0x0A12,   // 0x1ED0 (7888)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x22B3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0x3DF8, 0x35D8,   // 0x1EE0 (7904)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x8EDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1EF0 (7920)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F00 (7936)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x1F10 (7952)
-0x4618, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xDF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F20 (7968)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F30 (7984)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEBD, 0x6C57, 0x2AD4, 0x01F2, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x1F40 (8000)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x09F2, 0xF7BF,   // 0x1F50 (8016)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x1F60 (8032)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2293, 0xF7DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1F70 (8048)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9559, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x53D6,   // 0x1F80 (8064)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9EFC, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1F90 (8080)
-0x35D8, 0x35D8, 0xE7BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FA0 (8096)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1FB0 (8112)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x769A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x1FC0 (8128)
-0x35D8, 0x5E59, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xB73D,   // 0x1FD0 (8144)
-0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1FE0 (8160)
-0x0000, 0x0000, 0xFFFF, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xEF9F, 0xC69C, 0x2AB3, 0x01D1,   // 0x1FF0 (8176)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xCEBD, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2000 (8192)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2010 (8208)
-0x7498, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF7E, 0x1252, 0x01D1,   // 0x2020 (8224)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x957A, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4618, 0x35D8, 0x35D8,   // 0x2030 (8240)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x7EBA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2040 (8256)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2050 (8272)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x2060 (8288)
-0xBF5D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x7E9A, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2070 (8304)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x769A, 0x35D8, 0x667A, 0xE7BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2080 (8320)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2090 (8336)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB63B, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB63B,   // 0x20A0 (8352)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x20B0 (8368)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x9559, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20C0 (8384)
-0x0000, 0x0000, 0x0000, 0x0000, 0xEF7E, 0x2AF4, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01F2, 0xE75E,   // 0x20D0 (8400)
-0x0000, 0x0000, 0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x20E0 (8416)
-0x35D8, 0xDFBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x20F0 (8432)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2100 (8448)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4618, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2110 (8464)
-0x35D8, 0x35D8, 0x35D8, 0x6E7A, 0xE7BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE7BF, 0x667A, 0x35D8, 0x35D8,   // 0x2120 (8480)
-0x35D8, 0x3DF8, 0xB73D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2130 (8496)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBE5B, 0x01D1,   // 0x2140 (8512)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xAE1B, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2150 (8528)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2160 (8544)
-0x01D1, 0x01D1, 0x6C57, 0xF7BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC69C, 0x2293, 0x01D1, 0x01D1, 0x01D1,   // 0x2170 (8560)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x53D6, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x4E19, 0x35D8, 0x35D8, 0x35D8,   // 0x2180 (8576)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x767A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2190 (8592)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21A0 (8608)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x21B0 (8624)
-0x0000, 0xAF1C, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35F8, 0x7EBB, 0xC75D, 0xEFDF,   // 0x21C0 (8640)
-0xFFFF, 0xEFDF, 0xCF7D, 0x86BB, 0x3DF8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x769A, 0xF7DF, 0x0000, 0x0000, 0x0000,   // 0x21D0 (8656)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x21E0 (8672)
-0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xCEDD, 0x2AF4, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xBE7C,   // 0x21F0 (8688)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2200 (8704)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x1A73, 0x7CB8, 0xC69C, 0xEF7E, 0xEF9F,   // 0x2210 (8720)
-0xE73E, 0xAE1B, 0x53D6, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01F1, 0xD6FD, 0x0000,   // 0x2220 (8736)
-0x0000, 0x0000, 0x0000, 0xBF3D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2230 (8752)
-0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2240 (8768)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2250 (8784)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x5639, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2260 (8800)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2270 (8816)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4618, 0xC75D, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2280 (8832)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2290 (8848)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xE77E, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x22A0 (8864)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x22B0 (8880)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x22C0 (8896)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x6C77, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x5639, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x22D0 (8912)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x665A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22E0 (8928)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x22F0 (8944)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x2300 (8960)
-0x0000, 0x0000, 0xD79E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2310 (8976)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x3DF8, 0xEFDF, 0x0000,   // 0x2320 (8992)
-0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2330 (9008)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2AD4, 0x0000,   // 0x2340 (9024)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2350 (9040)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2360 (9056)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2AB3, 0xF7BF, 0x0000, 0x0000,   // 0x2370 (9072)
-0x0000, 0x0000, 0xC77D, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xC77D,   // 0x2380 (9088)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2390 (9104)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x23A0 (9120)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA71C, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x23B0 (9136)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x23C0 (9152)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xB73D, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x23D0 (9168)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x23E0 (9184)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x8519, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x23F0 (9200)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2400 (9216)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2410 (9232)
-0x01D1, 0x01D1, 0x01D1, 0x1232, 0xDF1D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6659, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2420 (9248)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5639, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2430 (9264)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2440 (9280)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x2450 (9296)
-0x0000, 0x0000, 0x0000, 0x0000, 0x9EFC, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2460 (9312)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xA71C, 0x0000, 0x0000, 0x0000,   // 0x2470 (9328)
-0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2480 (9344)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x1A73, 0xF7BF, 0x0000,   // 0x2490 (9360)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x24A0 (9376)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x24B0 (9392)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0A12, 0xC67C, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24C0 (9408)
-0x0000, 0xD79E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xBF3D, 0x0000,   // 0x24D0 (9424)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x24E0 (9440)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x24F0 (9456)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAF1C, 0x35D8, 0x35D8,   // 0x2500 (9472)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2510 (9488)
-0x35D8, 0x35D8, 0x35D8, 0xAF1C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2520 (9504)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2530 (9520)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01F2, 0xBE5B, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2540 (9536)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2550 (9552)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2560 (9568)
-0x01D1, 0x1A73, 0xC69C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6E7A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2570 (9584)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4E19, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2580 (9600)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2590 (9616)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x25A0 (9632)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF7E, 0x4E39, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x25B0 (9648)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x5639, 0xD79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x25C0 (9664)
-0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x25D0 (9680)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x09F2, 0xA5DA, 0x0000, 0x0000, 0x0000,   // 0x25E0 (9696)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x25F0 (9712)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2600 (9728)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x53D6, 0xEF7E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2610 (9744)
-0xDF9E, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0xAF1C, 0x0000, 0x0000,   // 0x2620 (9760)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2630 (9776)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x2640 (9792)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7FF,   // 0x2650 (9808)
-0x9EFC, 0x3DF8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x45F8,   // 0x2660 (9824)
-0xA71C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2670 (9840)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2680 (9856)
-0x01D1, 0x01D1, 0x2AB3, 0xC69C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2690 (9872)
-0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x7498,   // 0x26A0 (9888)
-0x0A12, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2AF4, 0xB63B,   // 0x26B0 (9904)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7E9A, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8,   // 0x26C0 (9920)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x4618, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26D0 (9936)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x26E0 (9952)
-0x0000, 0x4E19, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x96FB, 0x0000, 0x0000, 0x0000,   // 0x26F0 (9968)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7DF, 0xAF1C, 0x665A, 0x35F8, 0x35D8, 0x35D8, 0x35D8,   // 0x2700 (9984)
-0x35D8, 0x35D8, 0x35D8, 0x35D8, 0x35F8, 0x6E7A, 0xB73C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2710 (10000)
-0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2720 (10016)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x2AF4, 0x957A, 0xFFDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2730 (10032)
-0x0000, 0x0000, 0xA5BA, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0xB61B, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2740 (10048)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0xEF9E, 0x9559, 0x3B34, 0x01F2, 0x01D1, 0x01D1, 0x01D1, 0x01D1,   // 0x2750 (10064)
-0x01D1, 0x01D1, 0x01D1, 0x1232, 0x5BF6, 0xBE5C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2760 (10080)
-0xB73D, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xCF7E, 0x0000, 0x0000, 0x0000,   // 0x2770 (10096)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2780 (10112)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBF5D, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xB73C,   // 0x2790 (10128)
-0xB73C, 0xB73C, 0xB73C, 0xB73C, 0xDF9E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x27A0 (10144)
-0x0000, 0x0000, 0x0000, 0x0000, 0xF7FF, 0xD79E, 0xB73D, 0xA71C, 0xA71C, 0xA71C, 0xBF3D, 0xD79E, 0xFFFF, 0x0000, 0x0000, 0x0000,   // 0x27B0 (10160)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC67C, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559,   // 0x27C0 (10176)
-0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0x9559, 0xADFB, 0xDF3E,   // 0x27D0 (10192)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF1D, 0xA5BA, 0xA5BA, 0xA5BA, 0xA5BA, 0xA5BA,   // 0x27E0 (10208)
-0xA5BA, 0xA5BA, 0xA5BA, 0xE75E, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x27F0 (10224)
-0x0000, 0x0000, 0x0000, 0xF7BF, 0xC67C, 0xADDB, 0x957A, 0x9559, 0x9D9A, 0xADFB, 0xD6FD, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2800 (10240)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2810 (10256)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2820 (10272)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2830 (10288)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2840 (10304)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2850 (10320)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2860 (10336)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2870 (10352)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2880 (10368)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2890 (10384)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28A0 (10400)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28B0 (10416)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28C0 (10432)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28D0 (10448)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28E0 (10464)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x28F0 (10480)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2900 (10496)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2910 (10512)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2920 (10528)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2930 (10544)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x2940 (10560)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2950 (10576)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2960 (10592)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2970 (10608)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2980 (10624)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2990 (10640)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29A0 (10656)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29B0 (10672)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29C0 (10688)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29D0 (10704)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x29E0 (10720)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x29F0 (10736)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A00 (10752)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A10 (10768)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A20 (10784)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A30 (10800)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A40 (10816)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A50 (10832)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A60 (10848)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A70 (10864)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2A80 (10880)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x2A90 (10896)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AA0 (10912)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AB0 (10928)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AC0 (10944)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AD0 (10960)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AE0 (10976)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2AF0 (10992)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B00 (11008)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B10 (11024)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B20 (11040)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2B30 (11056)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B40 (11072)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B50 (11088)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B60 (11104)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B70 (11120)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B80 (11136)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2B90 (11152)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BA0 (11168)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BB0 (11184)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BC0 (11200)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BD0 (11216)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x2BE0 (11232)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2BF0 (11248)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C00 (11264)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C10 (11280)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C20 (11296)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C30 (11312)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C40 (11328)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C50 (11344)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C60 (11360)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C70 (11376)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2C80 (11392)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2C90 (11408)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CA0 (11424)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CB0 (11440)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CC0 (11456)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CD0 (11472)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CE0 (11488)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2CF0 (11504)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D00 (11520)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D10 (11536)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D20 (11552)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x2D30 (11568)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D40 (11584)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D50 (11600)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D60 (11616)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D70 (11632)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D80 (11648)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2D90 (11664)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DA0 (11680)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DB0 (11696)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DC0 (11712)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2DD0 (11728)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DE0 (11744)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2DF0 (11760)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E00 (11776)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E10 (11792)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E20 (11808)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E30 (11824)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E40 (11840)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E50 (11856)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E60 (11872)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E70 (11888)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x2E80 (11904)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2E90 (11920)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EA0 (11936)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EB0 (11952)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EC0 (11968)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2ED0 (11984)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EE0 (12000)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2EF0 (12016)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F00 (12032)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F10 (12048)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x2F20 (12064)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F30 (12080)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F40 (12096)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F50 (12112)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F60 (12128)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F70 (12144)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F80 (12160)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2F90 (12176)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FA0 (12192)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FB0 (12208)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FC0 (12224)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x2FD0 (12240)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FE0 (12256)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x2FF0 (12272)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3000 (12288)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3010 (12304)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3020 (12320)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3030 (12336)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3040 (12352)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3050 (12368)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3060 (12384)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x3070 (12400)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3080 (12416)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3090 (12432)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30A0 (12448)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30B0 (12464)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30C0 (12480)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30D0 (12496)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30E0 (12512)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x30F0 (12528)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3100 (12544)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3110 (12560)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x3120 (12576)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3130 (12592)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3140 (12608)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3150 (12624)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3160 (12640)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3170 (12656)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3180 (12672)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3190 (12688)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31A0 (12704)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31B0 (12720)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1,   // 0x31C0 (12736)
-0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31D0 (12752)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31E0 (12768)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x31F0 (12784)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3200 (12800)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3210 (12816)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3220 (12832)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3230 (12848)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3240 (12864)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3250 (12880)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3260 (12896)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7498, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x01D1, 0x0000,   // 0x3270 (12912)
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3280 (12928)
+#pragma once
+
+#include "acsip_rle.h"
+
+#define ACSIPLOGO_WIDTH     168
+#define ACSIPLOGO_HEIGHT    77
+
+static const uint16_t acsiplogo_palette[122] = {
+0x0000, 0x35D8, 0x01D1, 0xFFFF, 0x7498, 0x4E19, 0xA5BA, 0x96FB, 0xB61B, 0x9559, 0x32F4, 0x53D6, 0x3DF8, 0xF7DF, 0xB73C, 0x4618,
+0x6E7A, 0xD79E, 0xEFDF, 0x35F8, 0x9EFC, 0xA71C, 0xAF1C, 0x5639, 0x6659, 0x2293, 0x5E59, 0x7E9A, 0x769A, 0xBF5D, 0xE7BE, 0xEF9F,
+0x86BB, 0x8EDB, 0xC75D, 0x0A12, 0xB73D, 0xDF9E, 0xCF7D, 0xF7BF, 0xF7FF, 0x665A, 0x96DB, 0xB63B, 0xDFBE, 0x01F2, 0x1232, 0x1A73,
+0x667A, 0x8D39, 0xBF3D, 0xC69C, 0xC77D, 0xCF7E, 0xD6FD, 0xE7BF, 0x3314, 0x3B34, 0x4B95, 0xADFB, 0xAE1B, 0xC67C, 0xDF1D, 0xE75E,
+0xEF7E, 0xFFDF, 0x01F1, 0x22B3, 0x2AF4, 0x4E18, 0x6417, 0x8519, 0xCEBD, 0x09F2, 0x2AB3, 0x2AD4, 0x4E39, 0x53F6, 0x6C57, 0x6C77,
+0x7EBA, 0x957A, 0x9D9A, 0xA5DA, 0xADDB, 0xBE5C, 0xBE7C, 0xDF3E, 0x3B35, 0x3B55, 0x4375, 0x45F8, 0x6437, 0x6457, 0x767A, 0x7CD8,
+0xA6FC, 0xBE5B, 0xCEBC, 0xCEDD, 0xD6DD, 0xD77E, 0xE73E, 0xE77E, 0xEF9E, 0xF79F, 0x1252, 0x1A53, 0x4355, 0x4BB6, 0x5BF6, 0x5C16,
+0x5E39, 0x74B8, 0x7CB8, 0x7EBB, 0x84F8, 0x9D7A, 0x9DBA, 0xA5DB, 0xAF3C, 0xEFBF,
+};
+
+static const uint8_t acsiplogo_data[2339] = {
+0x00, 0x1E, 0x92, 0x96, 0x9C, 0xCC, 0x93, 0x01, 0x00, 0x8F, 0x98, 0xA1, 0xB4, 0x83, 0x00, 0x50,
+0x8D, 0x8C, 0x85, 0x9A, 0x9B, 0x95, 0x91, 0x83, 0x00, 0x3E, 0xAC, 0x9C, 0x01, 0x09, 0x85, 0x8E,
+0x83, 0x00, 0x4E, 0x8D, 0x01, 0x04, 0x8F, 0xA1, 0xAC, 0x00, 0x3A, 0x83, 0xAA, 0x01, 0x0D, 0x9A,
+0xAC, 0x00, 0x4D, 0x8D, 0x01, 0x07, 0x9C, 0xAC, 0x00, 0x37, 0x92, 0x98, 0x01, 0x0F, 0x8C, 0xA2,
+0x00, 0x4C, 0x83, 0x8D, 0x9E, 0xA6, 0x96, 0x9B, 0x8F, 0x01, 0x03, 0xAA, 0x83, 0x00, 0x34, 0x92,
+0x97, 0x01, 0x12, 0x9D, 0x00, 0x51, 0x83, 0xA2, 0x90, 0x01, 0x02, 0x9A, 0x9E, 0x00, 0x32, 0x83,
+0x9A, 0x01, 0x13, 0x93, 0x91, 0x00, 0x53, 0x91, 0x9A, 0x01, 0x01, 0x8F, 0x91, 0x00, 0x31, 0xA1,
+0x01, 0x15, 0x85, 0x8D, 0x00, 0x49, 0x8D, 0x8C, 0xC5, 0xA9, 0xA1, 0xA6, 0x83, 0x00, 0x01, 0x83,
+0x94, 0x01, 0x01, 0x8C, 0x91, 0x00, 0x2F, 0xAC, 0x01, 0x17, 0xA1, 0x00, 0x49, 0x8D, 0x01, 0x03,
+0x8F, 0x94, 0xA8, 0x00, 0x01, 0xA6, 0x8C, 0x01, 0x00, 0xDB, 0x9E, 0x00, 0x2E, 0x9B, 0x01, 0x17,
+0x8C, 0x92, 0x00, 0x48, 0x8D, 0xCC, 0x8C, 0x01, 0x03, 0x8F, 0x9D, 0x00, 0x01, 0x91, 0x8C, 0x01,
+0x00, 0x9A, 0x83, 0x00, 0x2C, 0x9E, 0x01, 0x19, 0x95, 0x00, 0x4B, 0x92, 0xA4, 0x90, 0x01, 0x02,
+0xA1, 0x83, 0x00, 0x00, 0xA6, 0x01, 0x01, 0xA1, 0x00, 0x2C, 0xA0, 0x01, 0x19, 0x9A, 0x00, 0x4E,
+0xA5, 0xA9, 0x01, 0x01, 0x9B, 0x83, 0x00, 0x00, 0x95, 0x01, 0x01, 0xA5, 0x00, 0x2A, 0x92, 0x93,
+0x01, 0x09, 0x93, 0xA0, 0xB2, 0x96, 0x97, 0x01, 0x0A, 0xA8, 0x00, 0x4E, 0x83, 0x94, 0x01, 0x01,
+0xA1, 0x00, 0x00, 0x83, 0x9A, 0x01, 0x00, 0x90, 0x00, 0x2A, 0xAA, 0x01, 0x09, 0x93, 0xE5, 0x00,
+0x01, 0x83, 0x90, 0x01, 0x09, 0x91, 0x00, 0x47, 0x8D, 0x85, 0x98, 0x87, 0xA5, 0x00, 0x02, 0xA4,
+0x01, 0x01, 0xA2, 0x00, 0x00, 0x91, 0x01, 0x01, 0xA5, 0x00, 0x28, 0x8D, 0x8C, 0x01, 0x09, 0xAA,
+0x00, 0x03, 0xF9, 0x01, 0x09, 0xA2, 0x00, 0x47, 0x8D, 0x01, 0x02, 0x9B, 0x92, 0x00, 0x01, 0x94,
+0x01, 0x00, 0x8F, 0xA8, 0x00, 0x00, 0x90, 0x01, 0x00, 0xA0, 0x00, 0x28, 0x94, 0x01, 0x09, 0x93,
+0x92, 0x00, 0x04, 0x8F, 0x01, 0x08, 0xF8, 0x00, 0x47, 0x83, 0x94, 0x9B, 0x8C, 0x01, 0x00, 0x8F,
+0x9E, 0x00, 0x00, 0x83, 0x98, 0x01, 0x00, 0x94, 0x00, 0x00, 0xB4, 0x01, 0x00, 0x8C, 0x83, 0x00,
+0x26, 0x83, 0x8F, 0x01, 0x09, 0xA0, 0x00, 0x05, 0x85, 0x01, 0x08, 0xE0, 0x00, 0x4A, 0xA8, 0x87,
+0x01, 0x00, 0xC5, 0x8D, 0x00, 0x00, 0x91, 0x01, 0x00, 0x8F, 0x83, 0x80, 0x83, 0x8F, 0x01, 0x00,
+0xB5, 0x00, 0x26, 0x96, 0x01, 0x0A, 0x9E, 0x00, 0x05, 0x85, 0x01, 0x08, 0x87, 0x00, 0x46, 0xB3,
+0x31, 0x00, 0xE2, 0x03, 0x00, 0x9D, 0x01, 0x00, 0xD0, 0x00, 0x01, 0x98, 0x01, 0x00, 0xA6, 0x00,
+0x00, 0x9B, 0x01, 0x00, 0x94, 0x00, 0x25, 0x83, 0x85, 0x01, 0x09, 0x9B, 0x00, 0x06, 0x85, 0x01,
+0x08, 0x87, 0x00, 0x44, 0xE9, 0xBA, 0x02, 0x02, 0xCD, 0xA7, 0x83, 0xA1, 0x01, 0x00, 0xB7, 0x00,
+0x00, 0x96, 0x01, 0x00, 0xAA, 0x00, 0x00, 0x96, 0x01, 0x00, 0x9C, 0x00, 0x25, 0xB2, 0x01, 0x0A,
+0xA5, 0x00, 0x06, 0x85, 0x01, 0x08, 0x87, 0x00, 0x44, 0x8B, 0x02, 0x04, 0xDC, 0x83, 0x8D, 0x93,
+0x81, 0x95, 0x00, 0x00, 0xAC, 0x01, 0x00, 0x90, 0x00, 0x00, 0xA6, 0x01, 0x00, 0xF0, 0x00, 0x24,
+0x83, 0x97, 0x01, 0x09, 0x90, 0x00, 0x07, 0x85, 0x01, 0x08, 0x87, 0x00, 0x43, 0xB6, 0x02, 0x05,
+0xC2, 0xC0, 0x80, 0xA9, 0x81, 0x9C, 0x00, 0x00, 0x83, 0x01, 0x00, 0x97, 0x00, 0x00, 0x9E, 0x01,
+0x00, 0xC5, 0x00, 0x24, 0xA2, 0x01, 0x0A, 0xB5, 0x00, 0x07, 0x85, 0x01, 0x08, 0x87, 0x00, 0x43,
+0xF7, 0x02, 0x06, 0xD5, 0x80, 0x94, 0x97, 0xA0, 0x00, 0x01, 0x98, 0x97, 0x90, 0x00, 0x00, 0x92,
+0x17, 0x00, 0x98, 0x00, 0x24, 0x98, 0x01, 0x09, 0x98, 0x00, 0x08, 0x85, 0x01, 0x08, 0x87, 0x00,
+0x43, 0xAB, 0x02, 0x06, 0xE2, 0x00, 0x33, 0xE5, 0x01, 0x0A, 0xA2, 0x00, 0x08, 0x85, 0x01, 0x08,
+0x87, 0x00, 0x43, 0xE9, 0xAE, 0x02, 0x04, 0xAF, 0xC1, 0x00, 0x33, 0x90, 0x01, 0x09, 0x97, 0x83,
+0x00, 0x08, 0x85, 0x01, 0x08, 0x87, 0x00, 0x44, 0xD2, 0x02, 0x03, 0xAD, 0x88, 0x00, 0x33, 0xA5,
+0x01, 0x0A, 0xA4, 0x00, 0x09, 0x85, 0x01, 0x08, 0x87, 0x00, 0x45, 0x88, 0x8A, 0x02, 0x00, 0xB9,
+0xD6, 0x00, 0x34, 0x9B, 0x01, 0x09, 0x85, 0x83, 0x00, 0x09, 0x85, 0x01, 0x08, 0x87, 0x00, 0x47,
+0x0D, 0x00, 0x00, 0x35, 0x9E, 0x01, 0x0A, 0x96, 0x00, 0x0A, 0x85, 0x01, 0x08, 0x87, 0x00, 0x80,
+0xA0, 0x01, 0x09, 0x8F, 0x83, 0x00, 0x0A, 0x85, 0x01, 0x08, 0x87, 0x00, 0x0C, 0x8D, 0x9D, 0x87,
+0x9C, 0xB0, 0x98, 0xA9, 0x9C, 0xAA, 0x9D, 0x8D, 0x00, 0x0F, 0x83, 0xD6, 0xC7, 0xEF, 0xDA, 0xD8,
+0x0A, 0x10, 0xD3, 0x00, 0x00, 0xBB, 0x19, 0x06, 0xD5, 0x00, 0x00, 0xB1, 0x0A, 0x06, 0x00, 0x01,
+0xBF, 0xF6, 0xCF, 0xBA, 0xB9, 0x8A, 0xEC, 0x8B, 0xDF, 0xAB, 0xA7, 0x00, 0x17, 0x92, 0x93, 0x01,
+0x09, 0x94, 0x00, 0x0B, 0x85, 0x01, 0x08, 0x87, 0x00, 0x09, 0x83, 0xA2, 0x90, 0x01, 0x09, 0x90,
+0xB4, 0x00, 0x0B, 0xC1, 0xB1, 0xAF, 0x02, 0x15, 0x89, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00,
+0x00, 0x84, 0x02, 0x06, 0xC1, 0x86, 0xB9, 0x02, 0x08, 0xA3, 0xC6, 0xC8, 0x00, 0x15, 0xAA, 0x01,
+0x09, 0x8C, 0x8D, 0x00, 0x0B, 0x85, 0x01, 0x08, 0x87, 0x00, 0x08, 0x91, 0x9A, 0x01, 0x0D, 0x9A,
+0x91, 0x00, 0x08, 0xD7, 0x8A, 0x02, 0x17, 0x89, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00,
+0x84, 0x02, 0x06, 0x99, 0x02, 0x0D, 0xCD, 0xBF, 0x00, 0x12, 0x8D, 0x8C, 0x01, 0x09, 0xA1, 0x00,
+0x0C, 0x85, 0x01, 0x08, 0x87, 0x00, 0x06, 0x83, 0x94, 0x01, 0x11, 0x94, 0x83, 0x00, 0x05, 0xE7,
+0x99, 0x02, 0x18, 0x89, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x17, 0xAE,
+0xBB, 0x00, 0x11, 0x94, 0x01, 0x09, 0x93, 0x92, 0x00, 0x0C, 0x85, 0x01, 0x08, 0x87, 0x00, 0x05,
+0x83, 0xDE, 0x01, 0x13, 0x9C, 0xA8, 0x00, 0x03, 0x83, 0xBA, 0x02, 0x19, 0x89, 0x00, 0x00, 0x86,
+0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x19, 0xC7, 0x00, 0x0F, 0x83, 0x8F, 0x01, 0x09, 0xA0,
+0x00, 0x0D, 0x85, 0x01, 0x08, 0x87, 0x00, 0x04, 0x83, 0x90, 0x01, 0x15, 0xB0, 0xA8, 0x00, 0x02,
+0xBC, 0x02, 0x1A, 0x89, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x1A, 0xDF,
+0x00, 0x0E, 0x96, 0x01, 0x0A, 0x9E, 0x00, 0x0D, 0x85, 0x01, 0x08, 0x87, 0x00, 0x04, 0xD0, 0x01,
+0x17, 0xB0, 0x83, 0x00, 0x01, 0xB8, 0x02, 0x1A, 0x89, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00,
+0x00, 0x84, 0x02, 0x1B, 0x89, 0x00, 0x0C, 0x83, 0x85, 0x01, 0x09, 0x9C, 0x00, 0x0E, 0x85, 0x01,
+0x08, 0x87, 0x00, 0x03, 0x96, 0x01, 0x18, 0x8C, 0xB5, 0x00, 0x00, 0xB6, 0x02, 0x1B, 0x89, 0x00,
+0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x1B, 0xA3, 0xE4, 0x00, 0x0B, 0xB2, 0x01,
+0x0A, 0x91, 0x00, 0x0E, 0x85, 0x01, 0x08, 0x87, 0x00, 0x02, 0x92, 0x8C, 0x01, 0x09, 0x8C, 0x98,
+0x90, 0x9A, 0x8C, 0x01, 0x07, 0xA9, 0x9E, 0x00, 0x01, 0xB1, 0x02, 0x06, 0xC2, 0xD9, 0x0B, 0x11,
+0xAB, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x0C, 0xC3, 0xED, 0x8B, 0xB9,
+0xA3, 0x02, 0x09, 0xD8, 0x83, 0x00, 0x09, 0x83, 0x97, 0x01, 0x09, 0x90, 0x00, 0x0F, 0x85, 0x01,
+0x08, 0x87, 0x00, 0x02, 0xA0, 0x01, 0x08, 0xB0, 0xB5, 0x83, 0x00, 0x01, 0x83, 0xA2, 0xA9, 0x01,
+0x03, 0x93, 0x95, 0x83, 0x00, 0x02, 0xCE, 0x02, 0x06, 0xBC, 0x00, 0x15, 0x86, 0x02, 0x06, 0x88,
+0x00, 0x00, 0x84, 0x02, 0x09, 0xC2, 0xDD, 0xBE, 0x00, 0x02, 0xA7, 0xD2, 0x99, 0x02, 0x08, 0xBB,
+0x00, 0x09, 0xA2, 0x01, 0x0A, 0xA6, 0x00, 0x0F, 0x85, 0x01, 0x08, 0x87, 0x00, 0x01, 0x8D, 0x93,
+0x01, 0x07, 0x95, 0x00, 0x07, 0xE0, 0x01, 0x01, 0x98, 0x9E, 0x00, 0x04, 0x8B, 0x02, 0x05, 0xAF,
+0x00, 0x16, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x08, 0xEB, 0xBD, 0x00, 0x06, 0x8D,
+0xC6, 0x02, 0x07, 0xB8, 0x00, 0x09, 0x98, 0x01, 0x09, 0x9A, 0x00, 0x10, 0x85, 0x01, 0x08, 0x87,
+0x00, 0x01, 0x95, 0x01, 0x07, 0xA4, 0x00, 0x09, 0xA4, 0x8C, 0x95, 0x83, 0x00, 0x05, 0xC6, 0x02,
+0x05, 0xAD, 0xE6, 0x00, 0x15, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x07, 0xAE, 0xB6,
+0x00, 0x08, 0x83, 0xDD, 0x02, 0x07, 0xE4, 0x00, 0x07, 0x91, 0x01, 0x0A, 0x9D, 0x00, 0x10, 0x85,
+0x01, 0x08, 0x87, 0x00, 0x01, 0xB0, 0x01, 0x06, 0xA0, 0x00, 0x0B, 0x92, 0x00, 0x07, 0xF1, 0x02,
+0x06, 0xC3, 0xB1, 0x06, 0x06, 0xD4, 0xAB, 0xBE, 0x83, 0x00, 0x08, 0x86, 0x02, 0x06, 0x88, 0x00,
+0x00, 0x84, 0x02, 0x07, 0xD4, 0x00, 0x0A, 0xC1, 0xB8, 0x02, 0x06, 0xF4, 0x00, 0x07, 0x90, 0x01,
+0x09, 0x97, 0x83, 0x00, 0x10, 0x85, 0x01, 0x08, 0x87, 0x00, 0x00, 0x83, 0x93, 0x01, 0x05, 0x8C,
+0x92, 0x00, 0x15, 0xD3, 0x02, 0x13, 0xA3, 0xCD, 0xAB, 0x83, 0x00, 0x05, 0x86, 0x02, 0x06, 0x88,
+0x00, 0x00, 0x84, 0x02, 0x06, 0xB8, 0x83, 0x00, 0x0B, 0xBD, 0x02, 0x06, 0xDA, 0x00, 0x06, 0xA5,
+0x01, 0x0A, 0x8E, 0x00, 0x11, 0x85, 0x01, 0x08, 0x87, 0x00, 0x00, 0xAC, 0x01, 0x06, 0x9B, 0x00,
+0x16, 0xE8, 0xC9, 0x02, 0x15, 0xB8, 0xB6, 0x00, 0x04, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84,
+0x02, 0x06, 0xF5, 0x00, 0x0D, 0xC3, 0x02, 0x05, 0xAF, 0x00, 0x06, 0x9B, 0x01, 0x09, 0xC5, 0x83,
+0x00, 0x11, 0x85, 0x01, 0x08, 0x87, 0x00, 0x00, 0xB4, 0x01, 0x06, 0x96, 0x00, 0x17, 0xDC, 0x02,
+0x16, 0xA3, 0x88, 0x00, 0x03, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x06, 0xBE, 0x00,
+0x0D, 0xC6, 0x02, 0x06, 0x00, 0x05, 0x9E, 0x01, 0x0A, 0x95, 0x00, 0x12, 0x85, 0x01, 0x08, 0x87,
+0x00, 0x00, 0x9D, 0x01, 0x06, 0x9D, 0x00, 0x17, 0xBF, 0xAE, 0x02, 0x16, 0xA3, 0xE3, 0x00, 0x02,
+0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x06, 0x8D, 0x00, 0x0D, 0x84, 0x02, 0x06, 0x00,
+0x05, 0xA0, 0x01, 0x09, 0x8C, 0xA8, 0x00, 0x12, 0x85, 0x01, 0x08, 0x87, 0x00, 0x00, 0x9D, 0x01,
+0x06, 0x9D, 0x00, 0x18, 0x88, 0xAD, 0x02, 0x16, 0xCB, 0x83, 0x00, 0x01, 0x86, 0x02, 0x06, 0x88,
+0x00, 0x00, 0x84, 0x02, 0x06, 0x9F, 0x00, 0x0D, 0xCF, 0x02, 0x06, 0x00, 0x04, 0x92, 0x93, 0x01,
+0x09, 0x87, 0x00, 0x13, 0x85, 0x01, 0x08, 0x87, 0x00, 0x00, 0xA6, 0x01, 0x06, 0x95, 0x00, 0x19,
+0xBC, 0xAE, 0x02, 0x16, 0x86, 0x00, 0x01, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x06,
+0xC8, 0x00, 0x0D, 0xBA, 0x02, 0x05, 0xA3, 0x00, 0x04, 0xAA, 0x01, 0x09, 0x8C, 0x92, 0x00, 0x13,
+0x85, 0x01, 0x08, 0x87, 0x00, 0x00, 0xB7, 0x01, 0x06, 0x90, 0x00, 0x1A, 0xD7, 0xBA, 0x02, 0x15,
+0xD9, 0x00, 0x01, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x06, 0xC7, 0x00, 0x0C, 0xA7,
+0xA3, 0x02, 0x05, 0xC3, 0x00, 0x03, 0x8D, 0x8C, 0x01, 0x09, 0xA1, 0x00, 0x14, 0x85, 0x01, 0x08,
+0x87, 0x00, 0x01, 0x8F, 0x01, 0x06, 0xA5, 0x00, 0x1B, 0xC8, 0xCE, 0xCB, 0xAD, 0x02, 0x11, 0xC9,
+0xA7, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x06, 0x99, 0x8D, 0x00, 0x0B,
+0x89, 0x02, 0x06, 0x8B, 0x00, 0x03, 0x94, 0x01, 0x0A, 0xB7, 0x00, 0x14, 0x85, 0x01, 0x08, 0x87,
+0x00, 0x01, 0x9C, 0x01, 0x06, 0x9A, 0x83, 0x00, 0x09, 0x83, 0xA4, 0x83, 0x00, 0x0F, 0x83, 0x1F,
+0x08, 0xB3, 0xCA, 0x02, 0x06, 0xC8, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02,
+0x07, 0x84, 0x00, 0x0A, 0xC0, 0xEA, 0x02, 0x06, 0xD1, 0x00, 0x02, 0x83, 0x8F, 0x01, 0x09, 0xD0,
+0x00, 0x15, 0x85, 0x01, 0x08, 0x87, 0x00, 0x01, 0x9D, 0x01, 0x07, 0x9B, 0x83, 0x00, 0x07, 0x83,
+0x9C, 0x81, 0xB0, 0xB7, 0x00, 0x1A, 0xAB, 0x02, 0x06, 0xAB, 0x00, 0x00, 0x86, 0x02, 0x06, 0x88,
+0x00, 0x00, 0x84, 0x02, 0x08, 0x89, 0x00, 0x08, 0xC0, 0xC4, 0x02, 0x06, 0xAD, 0xBF, 0x00, 0x02,
+0x96, 0x01, 0x0A, 0xAC, 0x00, 0x15, 0x85, 0x01, 0x08, 0x87, 0x00, 0x01, 0x83, 0x8F, 0x01, 0x07,
+0x90, 0xB7, 0x00, 0x05, 0xB7, 0xB0, 0x01, 0x01, 0x8C, 0xA4, 0x00, 0x19, 0xE1, 0x02, 0x06, 0xBC,
+0x00, 0x00, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x09, 0xCE, 0xA7, 0x00, 0x05, 0xB3,
+0x99, 0x02, 0x07, 0x8B, 0x00, 0x02, 0x83, 0x85, 0x01, 0x09, 0xDE, 0x00, 0x16, 0x85, 0x01, 0x08,
+0x87, 0x00, 0x02, 0x96, 0x01, 0x08, 0x93, 0xF3, 0xA2, 0x92, 0x83, 0x92, 0xA6, 0xA0, 0x8C, 0x01,
+0x04, 0x9C, 0x8D, 0x00, 0x15, 0x83, 0xE3, 0xC4, 0x02, 0x06, 0xD6, 0x00, 0x00, 0x86, 0x02, 0x06,
+0x88, 0x00, 0x00, 0x84, 0x02, 0x0A, 0xAF, 0xF2, 0xB3, 0xC0, 0x9F, 0xE6, 0xBC, 0x8B, 0x02, 0x08,
+0xC2, 0xB6, 0x00, 0x02, 0xB2, 0x01, 0x0A, 0x91, 0x00, 0x16, 0x85, 0x01, 0x08, 0x87, 0x00, 0x02,
+0x83, 0x97, 0x01, 0x17, 0x8F, 0xA2, 0x00, 0x01, 0x84, 0x02, 0x1B, 0xE7, 0x00, 0x00, 0x86, 0x02,
+0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x1C, 0xCF, 0x00, 0x02, 0x83, 0x97, 0x01, 0x09, 0xA9, 0x00,
+0x17, 0x85, 0x01, 0x08, 0x87, 0x00, 0x03, 0x91, 0x01, 0x18, 0x8C, 0x92, 0x00, 0x00, 0x84, 0x02,
+0x1A, 0xCB, 0x00, 0x01, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x1B, 0xCA, 0xA7, 0x00,
+0x02, 0xB4, 0x01, 0x0A, 0xB4, 0x00, 0x17, 0x85, 0x01, 0x08, 0x87, 0x00, 0x04, 0x95, 0x01, 0x17,
+0xA4, 0x00, 0x01, 0x84, 0x02, 0x1A, 0xC7, 0x00, 0x01, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84,
+0x02, 0x1A, 0xAE, 0xBE, 0x00, 0x03, 0x98, 0x01, 0x09, 0x97, 0x00, 0x18, 0x85, 0x01, 0x08, 0x87,
+0x00, 0x05, 0x94, 0x01, 0x15, 0x95, 0x00, 0x02, 0x84, 0x02, 0x19, 0xAF, 0xA7, 0x00, 0x01, 0x86,
+0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x19, 0xA3, 0xBD, 0x00, 0x03, 0x91, 0x01, 0x0A, 0xB2,
+0x00, 0x18, 0x85, 0x01, 0x08, 0x87, 0x00, 0x06, 0x96, 0x01, 0x13, 0x96, 0x00, 0x03, 0x84, 0x02,
+0x18, 0xAD, 0xE1, 0x00, 0x02, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x18, 0xAF, 0xB3,
+0x00, 0x04, 0x90, 0x01, 0x09, 0x85, 0x83, 0x00, 0x18, 0x85, 0x01, 0x08, 0x87, 0x00, 0x07, 0xB5,
+0xCC, 0x01, 0x0F, 0x97, 0x91, 0x00, 0x04, 0x84, 0x02, 0x17, 0xC9, 0xD3, 0x00, 0x03, 0x86, 0x02,
+0x06, 0x88, 0x00, 0x00, 0x84, 0x02, 0x17, 0x8B, 0xC0, 0x00, 0x04, 0xA5, 0x01, 0x0A, 0x96, 0x00,
+0x19, 0x85, 0x01, 0x08, 0x87, 0x00, 0x08, 0xA8, 0x94, 0x8C, 0x01, 0x0B, 0xDB, 0x95, 0x83, 0x00,
+0x05, 0x84, 0x02, 0x16, 0xCA, 0xB3, 0x00, 0x04, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00, 0x84, 0x02,
+0x06, 0x84, 0xA3, 0x02, 0x0B, 0xC4, 0xAB, 0x00, 0x06, 0x9B, 0x01, 0x09, 0x8F, 0x83, 0x00, 0x19,
+0x85, 0x01, 0x08, 0x87, 0x00, 0x0A, 0x8D, 0x96, 0xA9, 0x93, 0x01, 0x05, 0x93, 0x90, 0x8E, 0x83,
+0x00, 0x07, 0x84, 0x02, 0x14, 0xC4, 0xD1, 0xC1, 0x00, 0x05, 0x86, 0x02, 0x06, 0x88, 0x00, 0x00,
+0x84, 0x02, 0x06, 0x80, 0xE8, 0x89, 0xB9, 0xAD, 0x02, 0x05, 0xAE, 0xEE, 0xD5, 0x83, 0x00, 0x07,
+0xA4, 0x0E, 0x09, 0xB5, 0x00, 0x1A, 0x9D, 0x0E, 0x08, 0xA5, 0x00, 0x0D, 0xA8, 0x91, 0xA4, 0x15,
+0x01, 0xB2, 0x91, 0x83, 0x00, 0x0A, 0xBD, 0x09, 0x12, 0xBB, 0xD7, 0x00, 0x08, 0xBE, 0x06, 0x06,
+0xBF, 0x00, 0x00, 0x84, 0x02, 0x06, 0x00, 0x02, 0xA7, 0xBD, 0xD4, 0xD1, 0x89, 0xD2, 0xBB, 0xB6,
+0x83, 0x00, 0x90, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06,
+0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00,
+0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D,
+0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84,
+0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02, 0x06, 0x00, 0x9D, 0x84, 0x02,
+0x06, 0x00, 0x17,
+};
+
+static const AcsipRleImage acsiplogo = {
+    ACSIPLOGO_WIDTH, ACSIPLOGO_HEIGHT, acsiplogo_palette, acsiplogo_data, sizeof(acsiplogo_data)
 };